@@ -0,0 +1,225 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_ALLOCATOR_HPP
+#define JSONCONS_ARENA_ALLOCATOR_HPP
+
+#include <cstddef> // std::size_t, std::max_align_t
+#include <cstdint> // uintptr_t
+#include <limits> // std::numeric_limits
+#include <new> // ::operator new, std::bad_alloc
+#include <memory> // std::allocator_traits
+#include <scoped_allocator> // std::scoped_allocator_adaptor
+#include <type_traits>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+// arena
+
+// A monotonic memory resource: allocation bumps a pointer through a chain of blocks,
+// deallocation is a no-op, and all memory is returned when the arena is released or destroyed.
+class arena
+{
+    struct block_header
+    {
+        block_header* next;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t default_block_size = 4096;
+    static constexpr std::size_t max_block_size = std::size_t(1) << 20;
+
+    block_header* head_;
+    char* current_;
+    char* end_;
+    std::size_t next_block_size_;
+    std::size_t initial_block_size_;
+    std::size_t capacity_;
+public:
+    explicit arena(std::size_t initial_block_size = default_block_size) noexcept
+        : head_(nullptr), current_(nullptr), end_(nullptr),
+          next_block_size_(initial_block_size > 0 ? initial_block_size : std::size_t(default_block_size)),
+          initial_block_size_(next_block_size_), capacity_(0)
+    {
+    }
+
+    arena(const arena&) = delete;
+    arena(arena&&) = delete;
+    arena& operator=(const arena&) = delete;
+    arena& operator=(arena&&) = delete;
+
+    ~arena() noexcept
+    {
+        release();
+    }
+
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        char* p = align_up(current_, alignment);
+        if (p == nullptr || p > end_ || size > static_cast<std::size_t>(end_ - p))
+        {
+            if (size > (std::numeric_limits<std::size_t>::max)() - alignment)
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            add_block(size + alignment);
+            p = align_up(current_, alignment);
+        }
+        current_ = p + size;
+        return p;
+    }
+
+    void deallocate(void*, std::size_t) noexcept
+    {
+    }
+
+    // Returns every block to the system. Objects allocated from the arena must not be used afterwards.
+    void release() noexcept
+    {
+        block_header* block = head_;
+        while (block != nullptr)
+        {
+            block_header* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+        head_ = nullptr;
+        current_ = nullptr;
+        end_ = nullptr;
+        next_block_size_ = initial_block_size_;
+        capacity_ = 0;
+    }
+
+    // Total size of the blocks obtained from the system
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+private:
+    static char* align_up(char* p, std::size_t alignment) noexcept
+    {
+        if (p == nullptr)
+        {
+            return nullptr;
+        }
+        std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(p);
+        std::uintptr_t aligned = (addr + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+        return p + (aligned - addr);
+    }
+
+    void add_block(std::size_t min_size)
+    {
+        const std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+        if (min_size > max_size - sizeof(block_header))
+        {
+            JSONCONS_THROW(std::bad_alloc());
+        }
+        const std::size_t required = min_size + sizeof(block_header);
+        std::size_t size = next_block_size_;
+        while (size < required)
+        {
+            // Take just the required amount once doubling would overflow
+            if (size > max_size/2)
+            {
+                size = required;
+                break;
+            }
+            size *= 2;
+        }
+        auto block = static_cast<block_header*>(::operator new(size));
+        block->next = head_;
+        block->size = size;
+        head_ = block;
+        current_ = reinterpret_cast<char*>(block) + sizeof(block_header);
+        end_ = reinterpret_cast<char*>(block) + size;
+        capacity_ += size;
+        if (next_block_size_ < max_block_size)
+        {
+            next_block_size_ *= 2;
+        }
+    }
+};
+
+// arena_allocator
+
+template <class T>
+class arena_allocator
+{
+    template <class U> friend class arena_allocator;
+
+    arena* arena_;
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    explicit arena_allocator(arena& a) noexcept
+        : arena_(std::addressof(a))
+    {
+    }
+
+    arena_allocator(const arena_allocator&) noexcept = default;
+
+    template <class U>
+    arena_allocator(const arena_allocator<U>& other) noexcept
+        : arena_(other.arena_)
+    {
+    }
+
+    arena_allocator& operator=(const arena_allocator&) noexcept = default;
+
+    T* allocate(size_type n)
+    {
+        if (n > (std::numeric_limits<size_type>::max)()/sizeof(T))
+        {
+            JSONCONS_THROW(std::bad_alloc());
+        }
+        return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_type) noexcept
+    {
+    }
+
+    arena* resource() const noexcept
+    {
+        return arena_;
+    }
+
+    template <class U>
+    friend bool operator==(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+    {
+        return lhs.resource() == rhs.resource();
+    }
+
+    template <class U>
+    friend bool operator!=(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+    {
+        return lhs.resource() != rhs.resource();
+    }
+};
+
+// is_arena_allocator
+
+// Values allocated with an arena allocator hold no resources other than arena memory,
+// so basic_json skips their destructors and leaves reclamation to the arena.
+
+template <class Allocator>
+struct is_arena_allocator : std::false_type {};
+
+template <class T>
+struct is_arena_allocator<arena_allocator<T>> : std::true_type {};
+
+template <class T>
+struct is_arena_allocator<std::scoped_allocator_adaptor<arena_allocator<T>>> : std::true_type {};
+
+template <class T>
+using scoped_arena_allocator = std::scoped_allocator_adaptor<arena_allocator<T>>;
+
+} // namespace jsoncons
+
+#endif
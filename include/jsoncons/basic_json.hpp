@@ -29,6 +29,9 @@
 #include <jsoncons/pretty_print.hpp>
 #include <jsoncons/json_object.hpp>
 #include <jsoncons/json_array.hpp>
+#include <jsoncons/json_typed_array.hpp>
+#include <jsoncons/interned_key.hpp>
+#include <jsoncons/small_vector.hpp>
 #include <jsoncons/bigint.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_encoder.hpp>
@@ -38,6 +41,7 @@
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/allocator_set.hpp>
+#include <jsoncons/arena_allocator.hpp>
 #include <jsoncons/detail/heap_string.hpp>
 #if defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
 #include <memory_resource> // std::poymorphic_allocator
@@ -47,18 +51,18 @@ namespace jsoncons {
 
     namespace extension_traits {
 
-        template <class Container>
+        template <class Container,class Json>
         using 
-        container_array_iterator_type_t = decltype(Container::array_iterator_type);
-        template <class Container>
+        container_array_iterator_type_t = typename Container::template array_iterator_type<Json>;
+        template <class Container,class Json>
         using 
-        container_const_array_iterator_type_t = decltype(Container::const_array_iterator_type);
-        template <class Container>
+        container_const_array_iterator_type_t = typename Container::template const_array_iterator_type<Json>;
+        template <class Container,class KeyT,class Json>
         using 
-        container_object_iterator_type_t = decltype(Container::object_iterator_type);
-        template <class Container>
+        container_object_iterator_type_t = typename Container::template object_iterator<KeyT,Json>;
+        template <class Container,class KeyT,class Json>
         using 
-        container_const_object_iterator_type_t = decltype(Container::const_object_iterator_type);
+        container_const_object_iterator_type_t = typename Container::template const_object_iterator<KeyT,Json>;
 
         namespace detail {
 
@@ -279,6 +283,75 @@ namespace jsoncons {
         using member_key = std::basic_string<CharT, CharTraits, Allocator>;
     };
 
+    // Objects keyed by interned keys, see basic_interned_key
+    struct interned_sorted_policy : public sorted_policy
+    {
+        template <class CharT, class CharTraits, class Allocator>
+        using member_key = basic_interned_key<CharT, CharTraits, Allocator>;
+    };
+
+    struct interned_order_preserving_policy : public order_preserving_policy
+    {
+        template <class CharT, class CharTraits, class Allocator>
+        using member_key = basic_interned_key<CharT, CharTraits, Allocator>;
+    };
+
+    // Arrays and objects that keep up to InlineCapacity elements in the same allocation
+    // as their header, see small_vector
+    template <std::size_t InlineCapacity = 4>
+    struct small_sorted_policy : public sorted_policy
+    {
+        template <class T,class Allocator>
+        using sequence = small_vector<T,Allocator,InlineCapacity>;
+
+        template <class KeyT,class Json>
+        using object = sorted_json_object<KeyT,Json,sequence>;
+
+        template <class Json>
+        using array = json_array<Json,sequence>;
+
+        // The iterators of a small_vector are pointers, named here so that basic_json
+        // can declare its iterator types before its own size is known
+        template <class KeyT,class Json>
+        using object_iterator = key_value<KeyT,Json>*;
+
+        template <class KeyT,class Json>
+        using const_object_iterator = const key_value<KeyT,Json>*;
+
+        template <class Json>
+        using array_iterator_type = Json*;
+
+        template <class Json>
+        using const_array_iterator_type = const Json*;
+    };
+
+    template <std::size_t InlineCapacity = 4>
+    struct small_order_preserving_policy : public order_preserving_policy
+    {
+        template <class T,class Allocator>
+        using sequence = small_vector<T,Allocator,InlineCapacity>;
+
+        template <class KeyT,class Json>
+        using object = order_preserving_json_object<KeyT,Json,sequence>;
+
+        template <class Json>
+        using array = json_array<Json,sequence>;
+
+        // The iterators of a small_vector are pointers, named here so that basic_json
+        // can declare its iterator types before its own size is known
+        template <class KeyT,class Json>
+        using object_iterator = key_value<KeyT,Json>*;
+
+        template <class KeyT,class Json>
+        using const_object_iterator = const key_value<KeyT,Json>*;
+
+        template <class Json>
+        using array_iterator_type = Json*;
+
+        template <class Json>
+        using const_array_iterator_type = const Json*;
+    };
+
     template<class Policy, class KeyT,class Json, class Enable=void>
     struct object_iterator_typedefs
     {
@@ -286,8 +359,8 @@ namespace jsoncons {
 
     template<class Policy, class KeyT,class Json>
     struct object_iterator_typedefs<Policy, KeyT, Json, typename std::enable_if<
-        !extension_traits::is_detected<extension_traits::container_object_iterator_type_t, Policy>::value ||
-        !extension_traits::is_detected<extension_traits::container_const_object_iterator_type_t, Policy>::value>::type>
+        !extension_traits::is_detected<extension_traits::container_object_iterator_type_t, Policy, KeyT, Json>::value ||
+        !extension_traits::is_detected<extension_traits::container_const_object_iterator_type_t, Policy, KeyT, Json>::value>::type>
     {
         using object_iterator_type = jsoncons::detail::random_access_iterator_wrapper<typename Policy::template object<KeyT,Json>::iterator>;                    
         using const_object_iterator_type = jsoncons::detail::random_access_iterator_wrapper<typename Policy::template object<KeyT,Json>::const_iterator>;
@@ -295,8 +368,8 @@ namespace jsoncons {
 
     template<class Policy,class KeyT,class Json>
     struct object_iterator_typedefs<Policy, KeyT, Json, typename std::enable_if<
-        extension_traits::is_detected<extension_traits::container_object_iterator_type_t, Policy>::value &&
-        extension_traits::is_detected<extension_traits::container_const_object_iterator_type_t, Policy>::value>::type>
+        extension_traits::is_detected<extension_traits::container_object_iterator_type_t, Policy, KeyT, Json>::value &&
+        extension_traits::is_detected<extension_traits::container_const_object_iterator_type_t, Policy, KeyT, Json>::value>::type>
     {
         using object_iterator_type = jsoncons::detail::random_access_iterator_wrapper<typename Policy::template object_iterator<KeyT,Json>>;
         using const_object_iterator_type = jsoncons::detail::random_access_iterator_wrapper<typename Policy::template const_object_iterator<KeyT,Json>>;
@@ -309,8 +382,8 @@ namespace jsoncons {
 
     template<class Policy, class KeyT,class Json>
     struct array_iterator_typedefs<Policy, KeyT, Json, typename std::enable_if<
-        !extension_traits::is_detected<extension_traits::container_array_iterator_type_t, Policy>::value ||
-        !extension_traits::is_detected<extension_traits::container_const_array_iterator_type_t, Policy>::value>::type>
+        !extension_traits::is_detected<extension_traits::container_array_iterator_type_t, Policy, Json>::value ||
+        !extension_traits::is_detected<extension_traits::container_const_array_iterator_type_t, Policy, Json>::value>::type>
     {
         using array_iterator_type = typename Policy::template array<Json>::iterator;
         using const_array_iterator_type = typename Policy::template array<Json>::const_iterator;
@@ -318,8 +391,8 @@ namespace jsoncons {
 
     template<class Policy,class KeyT,class Json>
     struct array_iterator_typedefs<Policy, KeyT, Json, typename std::enable_if<
-        extension_traits::is_detected<extension_traits::container_array_iterator_type_t, Policy>::value &&
-        extension_traits::is_detected<extension_traits::container_const_array_iterator_type_t, Policy>::value>::type>
+        extension_traits::is_detected<extension_traits::container_array_iterator_type_t, Policy, Json>::value &&
+        extension_traits::is_detected<extension_traits::container_const_array_iterator_type_t, Policy, Json>::value>::type>
     {
         using array_iterator_type = typename Policy::template array_iterator_type<Json>;
         using const_array_iterator_type = typename Policy::template const_array_iterator_type<Json>;
@@ -438,6 +511,8 @@ namespace jsoncons {
 
         using array = typename policy_type::template array<basic_json>;
 
+        using typed_array = json_typed_array<basic_json>;
+
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;                       
 
         using object = typename policy_type::template object<key_type,basic_json>;
@@ -1046,6 +1121,119 @@ namespace jsoncons {
             }
         };
 
+        // typed_array_storage
+        class typed_array_storage final
+        {
+        public:
+            uint8_t storage_kind_:4;
+            uint8_t small_string_length_:4;
+            semantic_tag tag_;
+        private:
+            using typed_array_allocator = typename std::allocator_traits<Allocator>:: template rebind_alloc<typed_array>;
+            using pointer = typename std::allocator_traits<typed_array_allocator>::pointer;
+
+            pointer ptr_;
+
+            template <typename... Args>
+            void create(typed_array_allocator alloc, Args&& ... args)
+            {
+                ptr_ = std::allocator_traits<typed_array_allocator>::allocate(alloc, 1);
+                JSONCONS_TRY
+                {
+                    std::allocator_traits<typed_array_allocator>::construct(alloc, extension_traits::to_plain_pointer(ptr_), 
+                        std::forward<Args>(args)...);
+                }
+                JSONCONS_CATCH(...)
+                {
+                    std::allocator_traits<typed_array_allocator>::deallocate(alloc, ptr_,1);
+                    JSONCONS_RETHROW;
+                }
+            }
+
+            void destroy() noexcept
+            {
+                typed_array_allocator alloc(ptr_->get_allocator());
+                std::allocator_traits<typed_array_allocator>::destroy(alloc, extension_traits::to_plain_pointer(ptr_));
+                std::allocator_traits<typed_array_allocator>::deallocate(alloc, ptr_,1);
+            }
+        public:
+            typed_array_storage(typed_array&& val, semantic_tag tag)
+                : storage_kind_(static_cast<uint8_t>(json_storage_kind::typed_array_value)), small_string_length_(0), tag_(tag)
+            {
+                create(val.get_allocator(), std::move(val));
+            }
+
+            typed_array_storage(const typed_array_storage& other)
+                : storage_kind_(other.storage_kind_), small_string_length_(0), tag_(other.tag_)
+            {
+                create(other.ptr_->get_allocator(), *(other.ptr_));
+            }
+
+            typed_array_storage(typed_array_storage&& other) noexcept
+                : storage_kind_(other.storage_kind_), small_string_length_(0), tag_(other.tag_),
+                  ptr_(nullptr)
+            {
+                std::swap(other.ptr_, ptr_);
+
+                other.storage_kind_ = static_cast<uint8_t>(json_storage_kind::null_value);
+                other.small_string_length_ = 0;
+                other.tag_ = semantic_tag::none;
+            }
+
+            typed_array_storage(const typed_array_storage& other, const Allocator& alloc)
+                : storage_kind_(other.storage_kind_), small_string_length_(0), tag_(other.tag_)
+            {
+                create(typed_array_allocator(alloc), *(other.ptr_));
+            }
+
+            typed_array_storage(typed_array_storage&& other, const Allocator& alloc)
+                : storage_kind_(other.storage_kind_), small_string_length_(0), tag_(other.tag_)
+            {
+                if (other.get_allocator() == alloc)
+                {
+                    // Transfer resources 
+                    ptr_ = other.ptr_;
+                    other.ptr_ = nullptr;
+
+                    other.storage_kind_ = static_cast<uint8_t>(json_storage_kind::null_value);
+                    other.tag_ = semantic_tag::none;
+                }
+                else
+                {
+                    create(typed_array_allocator(alloc), *(other.ptr_));
+                }
+            }
+
+            ~typed_array_storage() noexcept
+            {
+                if (ptr_ != nullptr)
+                {
+                    destroy();
+                }
+            }
+
+            void swap(typed_array_storage& other)
+            {
+                std::swap(ptr_, other.ptr_);
+                std::swap(tag_, other.tag_);
+            }
+
+            semantic_tag tag() const
+            {
+                return tag_;
+            }
+
+            allocator_type get_allocator() const
+            {
+                return ptr_->get_allocator();
+            }
+
+            const typed_array& value() const
+            {
+                return *ptr_;
+            }
+        };
+
         // object_storage
         class object_storage final
         {
@@ -1820,6 +2008,12 @@ namespace jsoncons {
                 evaluate_with_default().insert(tag, first, last);
             }
 
+            template <class InputIt,class=typename std::enable_if<!std::is_convertible<InputIt,string_view_type>::value,typename std::iterator_traits<InputIt>::iterator_category>::type>
+            void insert_or_assign(InputIt first, InputIt last)
+            {
+                evaluate_with_default().insert_or_assign(first, last);
+            }
+
             template <typename... Args>
             void dump(Args&& ... args) const
             {
@@ -2211,12 +2405,23 @@ namespace jsoncons {
             long_string_storage long_string_stor_;
             byte_string_storage byte_string_stor_;
             array_storage array_stor_;
+            typed_array_storage typed_array_stor_;
             object_storage object_stor_;
             empty_object_storage empty_object_stor_;
             json_const_pointer_storage json_const_pointer_stor_;
         };
 
         void destroy()
+        {
+            destroy(std::integral_constant<bool,is_arena_allocator<Allocator>::value>());
+        }
+
+        // Arena memory is reclaimed by the arena as a whole
+        void destroy(std::true_type) noexcept
+        {
+        }
+
+        void destroy(std::false_type)
         {
             switch (storage_kind())
             {
@@ -2229,6 +2434,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     destroy_var<array_storage>();
                     break;
+                case json_storage_kind::typed_array_value:
+                    destroy_var<typed_array_storage>();
+                    break;
                 case json_storage_kind::object_value:
                     destroy_var<object_storage>();
                     break;
@@ -2384,6 +2592,16 @@ namespace jsoncons {
             return array_stor_;
         }
 
+        typed_array_storage& cast(identity<typed_array_storage>)
+        {
+            return typed_array_stor_;
+        }
+
+        const typed_array_storage& cast(identity<typed_array_storage>) const
+        {
+            return typed_array_stor_;
+        }
+
         json_const_pointer_storage& cast(identity<json_const_pointer_storage>) 
         {
             return json_const_pointer_stor_;
@@ -2427,6 +2645,11 @@ namespace jsoncons {
             cast<array_storage>().swap(other.cast<array_storage>());
         }
 
+        void swap_l_r(identity<typed_array_storage>,identity<typed_array_storage>,basic_json& other)
+        {
+            cast<typed_array_storage>().swap(other.cast<typed_array_storage>());
+        }
+
         void swap_l_r(identity<object_storage>,identity<object_storage>,basic_json& other)
         {
             cast<object_storage>().swap(other.cast<object_storage>());
@@ -2448,6 +2671,7 @@ namespace jsoncons {
                 case json_storage_kind::long_string_value  : swap_l_r<TypeL, long_string_storage>(other); break;
                 case json_storage_kind::byte_string_value  : swap_l_r<TypeL, byte_string_storage>(other); break;
                 case json_storage_kind::array_value        : swap_l_r<TypeL, array_storage>(other); break;
+                case json_storage_kind::typed_array_value  : swap_l_r<TypeL, typed_array_storage>(other); break;
                 case json_storage_kind::object_value       : swap_l_r<TypeL, object_storage>(other); break;
                 case json_storage_kind::json_const_pointer : swap_l_r<TypeL, json_const_pointer_storage>(other); break;
                 default:
@@ -2496,6 +2720,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     construct<array_storage>(other.cast<array_storage>());
                     break;
+                case json_storage_kind::typed_array_value:
+                    construct<typed_array_storage>(other.cast<typed_array_storage>());
+                    break;
                 case json_storage_kind::json_const_pointer:
                     construct<json_const_pointer_storage>(other.cast<json_const_pointer_storage>());
                     break;
@@ -2529,6 +2756,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     construct<array_storage>(other.cast<array_storage>(),alloc);
                     break;
+                case json_storage_kind::typed_array_value:
+                    construct<typed_array_storage>(other.cast<typed_array_storage>(),alloc);
+                    break;
                 case json_storage_kind::object_value:
                     construct<object_storage>(other.cast<object_storage>(),alloc);
                     break;
@@ -2563,6 +2793,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     construct<array_storage>(std::move(other.cast<array_storage>()));
                     break;
+                case json_storage_kind::typed_array_value:
+                    construct<typed_array_storage>(std::move(other.cast<typed_array_storage>()));
+                    break;
                 case json_storage_kind::object_value:
                     construct<object_storage>(std::move(other.cast<object_storage>()));
                     break;
@@ -2604,6 +2837,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     construct<array_storage>(std::move(other.cast<array_storage>()), alloc);
                     break;
+                case json_storage_kind::typed_array_value:
+                    construct<typed_array_storage>(std::move(other.cast<typed_array_storage>()), alloc);
+                    break;
                 case json_storage_kind::object_value:
                     construct<object_storage>(std::move(other.cast<object_storage>()), alloc);
                     break;
@@ -2663,6 +2899,7 @@ namespace jsoncons {
                 case json_storage_kind::long_string_value:   copy_assignment_l_r<long_string_storage,TypeR>(other);break;
                 case json_storage_kind::byte_string_value:   copy_assignment_l_r<byte_string_storage,TypeR>(other);break;
                 case json_storage_kind::array_value:         copy_assignment_l_r<array_storage,TypeR>(other);break;
+                case json_storage_kind::typed_array_value:   copy_assignment_l_r<typed_array_storage,TypeR>(other);break;
                 case json_storage_kind::object_value:        copy_assignment_l_r<object_storage,TypeR>(other);break;
                 default:
                     JSONCONS_UNREACHABLE();
@@ -2695,6 +2932,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     copy_assignment_r<array_storage>(other);
                     break;
+                case json_storage_kind::typed_array_value:
+                    copy_assignment_r<typed_array_storage>(other);
+                    break;
                 case json_storage_kind::object_value:
                     copy_assignment_r<object_storage>(other);
                     break;
@@ -2754,6 +2994,7 @@ namespace jsoncons {
                 case json_storage_kind::long_string_value:   move_assignment_l_r<long_string_storage,TypeR>(std::move(other));break;
                 case json_storage_kind::byte_string_value:   move_assignment_l_r<byte_string_storage,TypeR>(std::move(other));break;
                 case json_storage_kind::array_value:         move_assignment_l_r<array_storage,TypeR>(std::move(other));break;
+                case json_storage_kind::typed_array_value:   move_assignment_l_r<typed_array_storage,TypeR>(std::move(other));break;
                 case json_storage_kind::object_value:        move_assignment_l_r<object_storage,TypeR>(std::move(other));break;
                 default:
                     JSONCONS_UNREACHABLE();
@@ -2786,6 +3027,9 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     move_assignment_r<array_storage>(std::move(other));
                     break;
+                case json_storage_kind::typed_array_value:
+                    move_assignment_r<typed_array_storage>(std::move(other));
+                    break;
                 case json_storage_kind::object_value:
                     move_assignment_r<object_storage>(std::move(other));
                     break;
@@ -2871,6 +3115,7 @@ namespace jsoncons {
                 case json_storage_kind::byte_string_value:
                     return json_type::byte_string_value;
                 case json_storage_kind::array_value:
+                case json_storage_kind::typed_array_value:
                     return json_type::array_value;
                 case json_storage_kind::empty_object_value:
                 case json_storage_kind::object_value:
@@ -2904,6 +3149,8 @@ namespace jsoncons {
             {
                 case json_storage_kind::array_value:
                     return cast<array_storage>().value().size();
+                case json_storage_kind::typed_array_value:
+                    return cast<typed_array_storage>().value().size();
                 case json_storage_kind::empty_object_value:
                     return 0;
                 case json_storage_kind::object_value:
@@ -2977,6 +3224,10 @@ namespace jsoncons {
             {
                 return 0;
             }
+            if (storage_kind() == json_storage_kind::typed_array_value || rhs.storage_kind() == json_storage_kind::typed_array_value)
+            {
+                return compare_typed_array(rhs);
+            }
             switch (storage_kind())
             {
                 case json_storage_kind::json_const_pointer:
@@ -3067,6 +3318,20 @@ namespace jsoncons {
                             return static_cast<int>(storage_kind()) - static_cast<int>((int)rhs.storage_kind());
                     }
                     break;
+                case json_storage_kind::half_value:
+                    switch (rhs.storage_kind())
+                    {
+                        case json_storage_kind::half_value:
+                        {
+                            auto r = binary::decode_half(cast<half_storage>().value()) - binary::decode_half(rhs.cast<half_storage>().value());
+                            return r == 0 ? 0 : (r < 0.0 ? -1 : 1);
+                        }
+                        case json_storage_kind::json_const_pointer:
+                            return compare(*(rhs.cast<json_const_pointer_storage>().value()));
+                        default:
+                            return static_cast<int>(storage_kind()) - static_cast<int>((int)rhs.storage_kind());
+                    }
+                    break;
                 case json_storage_kind::double_value:
                     switch (rhs.storage_kind())
                     {
@@ -3203,6 +3468,7 @@ namespace jsoncons {
                 case json_storage_kind::long_string_value: swap_l<long_string_storage>(other); break;
                 case json_storage_kind::byte_string_value: swap_l<byte_string_storage>(other); break;
                 case json_storage_kind::array_value: swap_l<array_storage>(other); break;
+                case json_storage_kind::typed_array_value: swap_l<typed_array_storage>(other); break;
                 case json_storage_kind::object_value: swap_l<object_storage>(other); break;
                 case json_storage_kind::json_const_pointer: swap_l<json_const_pointer_storage>(other); break;
                 default:
@@ -3277,6 +3543,24 @@ namespace jsoncons {
             return parse(alloc_set, jsoncons::basic_string_view<char_type>(source), options);
         }
 
+        template <class Source>
+        static
+        typename std::enable_if<extension_traits::is_sequence_of<Source,char_type>::value && is_arena_allocator<allocator_type>::value,basic_json>::type
+            parse(arena& a, const Source& source, 
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>())
+        {
+            return parse(combine_allocators(allocator_type(arena_allocator<char>(a))), source, options);
+        }
+
+        template <class Alloc = allocator_type>
+        static
+        typename std::enable_if<is_arena_allocator<Alloc>::value,basic_json>::type
+            parse(arena& a, const char_type* source, 
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>())
+        {
+            return parse(a, jsoncons::basic_string_view<char_type>(source), options);
+        }
+
         static basic_json parse(const char_type* s, 
             const basic_json_decode_options<char_type>& options, 
             std::function<bool(json_errc,const ser_context&)> err_handler)
@@ -3311,7 +3595,7 @@ namespace jsoncons {
             const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>())
         {
             json_decoder<basic_json> decoder(alloc_set.get_allocator(), alloc_set.get_temp_allocator());
-            basic_json_reader<char_type,stream_source<char_type>,Allocator> reader(is, decoder, options, alloc_set.get_temp_allocator());
+            basic_json_reader<char_type,stream_source<char_type>,TempAllocator> reader(is, decoder, options, alloc_set.get_temp_allocator());
             reader.read_next();
             reader.check_done();
             if (!decoder.is_valid())
@@ -3321,6 +3605,15 @@ namespace jsoncons {
             return decoder.get_result();
         }
 
+        template <class Alloc = allocator_type>
+        static
+        typename std::enable_if<is_arena_allocator<Alloc>::value,basic_json>::type
+            parse(arena& a, std::basic_istream<char_type>& is, 
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>())
+        {
+            return parse(combine_allocators(allocator_type(arena_allocator<char>(a))), is, options);
+        }
+
         // from iterator
 
         template <class InputIt>
@@ -3614,6 +3907,24 @@ namespace jsoncons {
             construct<array_storage>(std::move(val), tag);
         }
 
+        template <class T>
+        basic_json(typed_array_arg_t, 
+                   const jsoncons::span<const T>& data, 
+                   semantic_tag tag = semantic_tag::none, 
+                   const Allocator& alloc = Allocator(),
+                   typename std::enable_if<detail::is_typed_array_element<T>::value,int>::type = 0)
+        {
+            construct<typed_array_storage>(typed_array(data, alloc), tag);
+        }
+
+        basic_json(typed_array_arg_t, half_arg_t,
+                   const jsoncons::span<const uint16_t>& data, 
+                   semantic_tag tag = semantic_tag::none, 
+                   const Allocator& alloc = Allocator())
+        {
+            construct<typed_array_storage>(typed_array(half_arg, data, alloc), tag);
+        }
+
         basic_json(const object& val, semantic_tag tag = semantic_tag::none)
         {
             construct<object_storage>(val, tag);
@@ -4128,6 +4439,10 @@ namespace jsoncons {
                 {
                     return cast<array_storage>().get_allocator();
                 }
+                case json_storage_kind::typed_array_value:
+                {
+                    return cast<typed_array_storage>().get_allocator();
+                }
                 case json_storage_kind::object_value:
                 {
                     return cast<object_storage>().get_allocator();
@@ -4286,6 +4601,7 @@ namespace jsoncons {
             switch (storage_kind())
             {
                 case json_storage_kind::array_value:
+                case json_storage_kind::typed_array_value:
                     return true;
                 case json_storage_kind::json_const_pointer:
                     return cast<json_const_pointer_storage>().value()->is_array();
@@ -4384,6 +4700,8 @@ namespace jsoncons {
                     return cast<long_string_storage>().length() == 0;
                 case json_storage_kind::array_value:
                     return cast<array_storage>().value().empty();
+                case json_storage_kind::typed_array_value:
+                    return cast<typed_array_storage>().value().empty();
                 case json_storage_kind::empty_object_value:
                     return true;
                 case json_storage_kind::object_value:
@@ -4401,6 +4719,8 @@ namespace jsoncons {
             {
                 case json_storage_kind::array_value:
                     return cast<array_storage>().value().capacity();
+                case json_storage_kind::typed_array_value:
+                    return cast<typed_array_storage>().value().size();
                 case json_storage_kind::object_value:
                     return cast<object_storage>().value().capacity();
                 case json_storage_kind::json_const_pointer:
@@ -4432,6 +4752,9 @@ namespace jsoncons {
             {
                 switch (storage_kind())
                 {
+                    case json_storage_kind::typed_array_value:
+                        expand_typed_array();
+                        JSONCONS_FALLTHROUGH;
                     case json_storage_kind::array_value:
                         cast<array_storage>().value().reserve(n);
                         break;
@@ -4456,6 +4779,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+                case json_storage_kind::typed_array_value:
+                    expand_typed_array();
+                    JSONCONS_FALLTHROUGH;
                 case json_storage_kind::array_value:
                     cast<array_storage>().value().resize(n);
                     break;
@@ -4469,6 +4795,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+                case json_storage_kind::typed_array_value:
+                    expand_typed_array();
+                    JSONCONS_FALLTHROUGH;
                 case json_storage_kind::array_value:
                     cast<array_storage>().value().resize(n, val);
                     break;
@@ -4807,6 +5136,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+                case json_storage_kind::typed_array_value:
+                    expand_typed_array();
+                    JSONCONS_FALLTHROUGH;
                 case json_storage_kind::array_value:
                     if (i >= cast<array_storage>().value().size())
                     {
@@ -4830,6 +5162,12 @@ namespace jsoncons {
                         JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                     }
                     return cast<array_storage>().value().operator[](i);
+                case json_storage_kind::typed_array_value:
+                    if (i >= cast<typed_array_storage>().value().size())
+                    {
+                        JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+                    }
+                    return materialize_typed_array().operator[](i);
                 case json_storage_kind::object_value:
                     return cast<object_storage>().value().at(i);
                 case json_storage_kind::json_const_pointer:
@@ -4955,6 +5293,12 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+            {
+                basic_json temp(array(cast<typed_array_storage>().get_allocator()), tag());
+                swap(temp);
+                break;
+            }
             case json_storage_kind::array_value:
                 cast<array_storage>().value().clear();
                 break;
@@ -4998,6 +5342,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().erase(pos);
             default:
@@ -5009,6 +5356,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().erase(first, last);
             default:
@@ -5139,7 +5489,7 @@ namespace jsoncons {
                     {
                         case json_storage_kind::empty_object_value:
                             create_object_implicitly();
-                            cast<object_storage>().value().merge(hint, source.cast<object_storage>().value());
+                            cast<object_storage>().value().merge(cast<object_storage>().value().begin(), source.cast<object_storage>().value());
                             break;
                         case json_storage_kind::object_value:
                             cast<object_storage>().value().merge(hint, source.cast<object_storage>().value());
@@ -5164,7 +5514,7 @@ namespace jsoncons {
                     {
                         case json_storage_kind::empty_object_value:
                             create_object_implicitly();
-                            cast<object_storage>().value().merge(hint, std::move(source.cast<object_storage>().value()));
+                            cast<object_storage>().value().merge(cast<object_storage>().value().begin(), std::move(source.cast<object_storage>().value()));
                             break;
                         case json_storage_kind::object_value:
                             cast<object_storage>().value().merge(hint, std::move(source.cast<object_storage>().value()));
@@ -5241,7 +5591,7 @@ namespace jsoncons {
                     {
                         case json_storage_kind::empty_object_value:
                             create_object_implicitly();
-                            cast<object_storage>().value().merge_or_update(hint, source.cast<object_storage>().value());
+                            cast<object_storage>().value().merge_or_update(cast<object_storage>().value().begin(), source.cast<object_storage>().value());
                             break;
                         case json_storage_kind::object_value:
                             cast<object_storage>().value().merge_or_update(hint, source.cast<object_storage>().value());
@@ -5266,7 +5616,7 @@ namespace jsoncons {
                     {
                         case json_storage_kind::empty_object_value:
                             create_object_implicitly();
-                            cast<object_storage>().value().merge_or_update(hint, std::move(source.cast<object_storage>().value()));
+                            cast<object_storage>().value().merge_or_update(cast<object_storage>().value().begin(), std::move(source.cast<object_storage>().value()));
                             break;
                         case json_storage_kind::object_value:
                             cast<object_storage>().value().merge_or_update(hint, std::move(source.cast<object_storage>().value()));
@@ -5287,7 +5637,7 @@ namespace jsoncons {
             {
             case json_storage_kind::empty_object_value:
                 create_object_implicitly();
-                return object_iterator(cast<object_storage>().value().insert_or_assign(hint, name, std::forward<T>(val)));
+                return object_iterator(cast<object_storage>().value().insert_or_assign(cast<object_storage>().value().begin(), name, std::forward<T>(val)));
             case json_storage_kind::object_value:
                 return object_iterator(cast<object_storage>().value().insert_or_assign(hint, name, std::forward<T>(val)));
             default:
@@ -5302,7 +5652,7 @@ namespace jsoncons {
             {
             case json_storage_kind::empty_object_value:
                 create_object_implicitly();
-                return object_iterator(cast<object_storage>().value().try_emplace(hint, name, std::forward<Args>(args)...));
+                return object_iterator(cast<object_storage>().value().try_emplace(cast<object_storage>().value().begin(), name, std::forward<Args>(args)...));
             case json_storage_kind::object_value:
                 return object_iterator(cast<object_storage>().value().try_emplace(hint, name, std::forward<Args>(args)...));
             default:
@@ -5315,6 +5665,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().insert(pos, std::forward<T>(val));
                 break;
@@ -5328,6 +5681,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().insert(pos, first, last);
                 break;
@@ -5370,11 +5726,32 @@ namespace jsoncons {
             }
         }
 
+        // Inserts or assigns each key-value pair in [first, last), the last of equal keys winning
+        template <class InputIt,class=typename std::enable_if<!std::is_convertible<InputIt,string_view_type>::value,typename std::iterator_traits<InputIt>::iterator_category>::type>
+        void insert_or_assign(InputIt first, InputIt last)
+        {
+            switch (storage_kind())
+            {
+            case json_storage_kind::empty_object_value:
+                create_object_implicitly();
+                cast<object_storage>().value().insert_or_assign(first, last);
+                break;
+            case json_storage_kind::object_value:
+                cast<object_storage>().value().insert_or_assign(first, last);
+                break;
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Attempting to insert into a value that is not an object"));
+            }
+        }
+
         template <class... Args> 
         array_iterator emplace(const_array_iterator pos, Args&&... args)
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().emplace(pos, std::forward<Args>(args)...);
                 break;
@@ -5388,6 +5765,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 return cast<array_storage>().value().emplace_back(std::forward<Args>(args)...);
             default:
@@ -5405,6 +5785,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 cast<array_storage>().value().push_back(std::forward<T>(val));
                 break;
@@ -5417,6 +5800,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 cast<array_storage>().value().push_back(std::move(val));
                 break;
@@ -5934,6 +6320,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+            case json_storage_kind::typed_array_value:
+                expand_typed_array();
+                JSONCONS_FALLTHROUGH;
             case json_storage_kind::array_value:
                 cast<array_storage>().value().remove_range(from_index, to_index);
                 break;
@@ -6031,6 +6420,9 @@ namespace jsoncons {
         {
             switch (storage_kind())
             {
+                case json_storage_kind::typed_array_value:
+                    expand_typed_array();
+                    JSONCONS_FALLTHROUGH;
                 case json_storage_kind::array_value:
                     return range<array_iterator, const_array_iterator>(cast<array_storage>().value().begin(),
                         cast<array_storage>().value().end());
@@ -6046,6 +6438,11 @@ namespace jsoncons {
                 case json_storage_kind::array_value:
                     return range<const_array_iterator, const_array_iterator>(cast<array_storage>().value().begin(),
                         cast<array_storage>().value().end());
+                case json_storage_kind::typed_array_value:
+                {
+                    const array& elements = materialize_typed_array();
+                    return range<const_array_iterator, const_array_iterator>(elements.begin(), elements.end());
+                }
                 case json_storage_kind::json_const_pointer:
                     return cast<json_const_pointer_storage>().value()->array_range();
                 default:
@@ -6055,6 +6452,66 @@ namespace jsoncons {
 
     private:
 
+        // Replaces a typed array with a regular array of the same elements
+        void expand_typed_array()
+        {
+            basic_json temp(cast<typed_array_storage>().value().to_array(), tag());
+            swap(temp);
+        }
+
+        // A const access by reference needs basic_json elements to refer to, so it replaces 
+        // a typed array with a regular array once, as a modification does. The value stays 
+        // equal, only its storage changes.
+        const array& materialize_typed_array() const
+        {
+            const_cast<basic_json*>(this)->expand_typed_array();
+            return cast<array_storage>().value();
+        }
+
+        // Compares as arrays when either side is a typed array, element by element, 
+        // without building the elements of a typed array
+        int compare_typed_array(const basic_json& rhs) const noexcept
+        {
+            if (storage_kind() == json_storage_kind::json_const_pointer)
+            {
+                return (cast<json_const_pointer_storage>().value())->compare(rhs);
+            }
+            if (rhs.storage_kind() == json_storage_kind::json_const_pointer)
+            {
+                return compare(*(rhs.cast<json_const_pointer_storage>().value()));
+            }
+            if (!is_array() || !rhs.is_array())
+            {
+                json_storage_kind lhs_kind = is_array() ? json_storage_kind::array_value : storage_kind();
+                json_storage_kind rhs_kind = rhs.is_array() ? json_storage_kind::array_value : rhs.storage_kind();
+                return static_cast<int>(lhs_kind) - static_cast<int>(rhs_kind);
+            }
+
+            const std::size_t n = (std::min)(size(), rhs.size());
+            basic_json lhs_scratch;
+            basic_json rhs_scratch;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                int diff = array_element(i, lhs_scratch).compare(rhs.array_element(i, rhs_scratch));
+                if (diff != 0)
+                {
+                    return diff < 0 ? -1 : 1;
+                }
+            }
+            return size() == rhs.size() ? 0 : (size() < rhs.size() ? -1 : 1);
+        }
+
+        // The i-th element of an array, read into scratch if this is a typed array
+        const basic_json& array_element(std::size_t i, basic_json& scratch) const noexcept
+        {
+            if (storage_kind() == json_storage_kind::typed_array_value)
+            {
+                scratch = cast<typed_array_storage>().value().element(i);
+                return scratch;
+            }
+            return cast<array_storage>().value()[i];
+        }
+
         void dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
         {
             const ser_context context{};
@@ -6112,6 +6569,9 @@ namespace jsoncons {
                     }
                     break;
                 }
+                case json_storage_kind::typed_array_value:
+                    cast<typed_array_storage>().value().dump(visitor, tag(), context, ec);
+                    break;
                 case json_storage_kind::array_value:
                 {
                     bool more = visitor.begin_array(size(), tag(), context, ec);
@@ -6421,6 +6881,10 @@ namespace jsoncons {
     using wjson = basic_json<wchar_t,sorted_policy,std::allocator<char>>;
     using ojson = basic_json<char, order_preserving_policy, std::allocator<char>>;
     using wojson = basic_json<wchar_t, order_preserving_policy, std::allocator<char>>;
+    using interned_json = basic_json<char,interned_sorted_policy,std::allocator<char>>;
+    using interned_ojson = basic_json<char,interned_order_preserving_policy,std::allocator<char>>;
+    using small_json = basic_json<char,small_sorted_policy<>,std::allocator<char>>;
+    using small_ojson = basic_json<char,small_order_preserving_policy<>,std::allocator<char>>;
 
     #if !defined(JSONCONS_NO_DEPRECATED)
     JSONCONS_DEPRECATED_MSG("Instead, use wojson") typedef basic_json<wchar_t, order_preserving_policy, std::allocator<wchar_t>> owjson;
@@ -6458,6 +6922,13 @@ namespace jsoncons {
 
     } // inline namespace literals
 
+    template< class CharT, class Policy>
+    using basic_arena_json = basic_json<CharT, Policy, scoped_arena_allocator<char>>;
+    using arena_json = basic_arena_json<char,sorted_policy>;
+    using arena_wjson = basic_arena_json<wchar_t,sorted_policy>;
+    using arena_ojson = basic_arena_json<char, order_preserving_policy>;
+    using arena_wojson = basic_arena_json<wchar_t, order_preserving_policy>;
+
     #if defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
     namespace pmr {
         template< class CharT, class Policy>
@@ -22,6 +22,7 @@
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/extension_traits.hpp>
+#include <jsoncons/detail/simd.hpp>
 
 namespace jsoncons {
 
@@ -29,73 +30,522 @@ namespace jsoncons {
 
 namespace detail {
 
-    template <class InputIt, class Container>
-    typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
-    encode_base64_generic(InputIt first, InputIt last, const char alphabet[65], Container& result)
+    // Containers that can be grown once and then written in place
+    template <class Container>
+    using container_subscript_t = decltype(std::declval<Container&>()[0]);
+
+    template <class Container, class Enable=void>
+    struct is_resizable_byte_buffer : std::false_type {};
+
+    template <class Container>
+    struct is_resizable_byte_buffer<Container,
+           typename std::enable_if<extension_traits::has_resize<Container>::value &&
+                                   extension_traits::has_data<Container>::value &&
+                                   extension_traits::is_detected_exact<typename Container::value_type&,container_subscript_t,Container>::value &&
+                                   std::is_integral<typename Container::value_type>::value &&
+                                   sizeof(typename Container::value_type) == 1
+    >::type> : std::true_type {};
+
+    template <class T, class Container>
+    typename std::enable_if<extension_traits::has_append<Container>::value &&
+                            sizeof(typename Container::value_type) == 1>::type
+    append_buffer(Container& result, const T* data, std::size_t length)
     {
-        std::size_t count = 0;
-        unsigned char a3[3];
-        unsigned char a4[4];
-        unsigned char fill = alphabet[64];
-        int i = 0;
-        int j = 0;
+        result.append(reinterpret_cast<const typename Container::value_type*>(data), length);
+    }
 
-        while (first != last)
+    template <class T, class Container>
+    typename std::enable_if<!(extension_traits::has_append<Container>::value &&
+                              sizeof(typename Container::value_type) == 1)>::type
+    append_buffer(Container& result, const T* data, std::size_t length)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            result.push_back(static_cast<typename Container::value_type>(data[i]));
+        }
+    }
+
+    // base64 kernels
+
+    inline
+    std::size_t base64_encoded_size(std::size_t length, bool padded)
+    {
+        return padded ? (length + 2) / 3 * 4 : (length * 4 + 2) / 3;
+    }
+
+    // Encodes [first,last) into dest, which must have room for base64_encoded_size characters,
+    // and returns the end of the output. The vector paths use the pshufb and multiply method of
+    // Mula and Lemire, and assume the first 62 characters of alphabet are A-Z, a-z and 0-9.
+
+    inline
+    char* encode_base64_block(const uint8_t* first, const uint8_t* last, const char alphabet[65], char* dest)
+    {
+        const uint8_t* p = first;
+    #if defined(JSONCONS_HAS_SSSE3)
+        const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+        const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, 
+                                                '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, 
+                                                static_cast<char>(alphabet[62] - 62), static_cast<char>(alphabet[63] - 63), 
+                                                'A', 0, 0);
+    #endif
+    #if defined(JSONCONS_HAS_AVX2)
         {
-            a3[i++] = *first++;
-            if (i == 3)
+            const __m256i shuffle256 = _mm256_broadcastsi128_si256(shuffle);
+            const __m256i shift_lut256 = _mm256_broadcastsi128_si256(shift_lut);
+            while (last - p >= 28)
             {
-                a4[0] = (a3[0] & 0xfc) >> 2;
-                a4[1] = ((a3[0] & 0x03) << 4) + ((a3[1] & 0xf0) >> 4);
-                a4[2] = ((a3[1] & 0x0f) << 2) + ((a3[2] & 0xc0) >> 6);
-                a4[3] = a3[2] & 0x3f;
+                __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12)), 1);
+                in = _mm256_shuffle_epi8(in, shuffle256);
+                __m256i hi = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+                __m256i lo = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+                __m256i indices = _mm256_or_si256(hi, lo);
+
+                __m256i shift = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+                shift = _mm256_or_si256(shift, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+                __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut256, shift), indices);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), chars);
+                p += 24;
+                dest += 32;
+            }
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSSE3)
+        while (last - p >= 16)
+        {
+            __m128i in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), shuffle);
+            __m128i hi = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+            __m128i lo = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+            __m128i indices = _mm_or_si128(hi, lo);
+
+            __m128i shift = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            shift = _mm_or_si128(shift, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+            __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, shift), indices);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), chars);
+            p += 12;
+            dest += 16;
+        }
+    #endif
+        while (last - p >= 3)
+        {
+            uint32_t v = (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8) | uint32_t(p[2]);
+            dest[0] = alphabet[v >> 18];
+            dest[1] = alphabet[(v >> 12) & 0x3f];
+            dest[2] = alphabet[(v >> 6) & 0x3f];
+            dest[3] = alphabet[v & 0x3f];
+            p += 3;
+            dest += 4;
+        }
 
-                for (i = 0; i < 4; i++) 
-                {
-                    result.push_back(alphabet[a4[i]]);
-                    ++count;
-                }
-                i = 0;
+        char fill = alphabet[64];
+        if (last - p == 1)
+        {
+            uint32_t v = uint32_t(p[0]) << 16;
+            *dest++ = alphabet[v >> 18];
+            *dest++ = alphabet[(v >> 12) & 0x3f];
+            if (fill != 0)
+            {
+                *dest++ = fill;
+                *dest++ = fill;
+            }
+        }
+        else if (last - p == 2)
+        {
+            uint32_t v = (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8);
+            *dest++ = alphabet[v >> 18];
+            *dest++ = alphabet[(v >> 12) & 0x3f];
+            *dest++ = alphabet[(v >> 6) & 0x3f];
+            if (fill != 0)
+            {
+                *dest++ = fill;
             }
         }
+        return dest;
+    }
 
-        if (i > 0)
+    // Decodes whole groups of four characters from [first,last) into dest, which must have room
+    // for three bytes a group, and stops before the first group that holds a character outside the
+    // alphabet, such as padding. Returns the first character not consumed and advances dest.
+
+    inline
+    const char* decode_base64_block(const char* first, const char* last, 
+                                    const uint8_t reverse_alphabet[256], char c62, char c63,
+                                    uint8_t*& dest)
+    {
+        const char* p = first;
+    #if defined(JSONCONS_HAS_SSE2)
+        while (last - p >= 16)
         {
-            for (j = i; j < 3; ++j) 
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+            __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+            __m128i is62 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c62));
+            __m128i is63 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c63));
+            __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+            if (_mm_movemask_epi8(valid) != 0xffff)
+            {
+                break;
+            }
+            __m128i shift = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), 
+                                                      _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+                                         _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                                                      _mm_or_si128(_mm_and_si128(is62, _mm_set1_epi8(static_cast<char>(62 - c62))),
+                                                                   _mm_and_si128(is63, _mm_set1_epi8(static_cast<char>(63 - c63))))));
+            __m128i values = _mm_add_epi8(v, shift);
+        #if defined(JSONCONS_HAS_SSSE3)
+            __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+            merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            uint8_t buffer[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), merged);
+            std::memcpy(dest, buffer, 12);
+        #else
+            __m128i pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 6), _mm_srli_epi16(values, 8));
+            __m128i groups = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0x0000ffff)), 12), _mm_srli_epi32(pairs, 16));
+            uint32_t words[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(words), groups);
+            for (int i = 0; i < 4; ++i)
             {
-                a3[j] = 0;
+                dest[3*i] = static_cast<uint8_t>(words[i] >> 16);
+                dest[3*i+1] = static_cast<uint8_t>(words[i] >> 8);
+                dest[3*i+2] = static_cast<uint8_t>(words[i]);
             }
+        #endif
+            p += 16;
+            dest += 12;
+        }
+    #else
+        (void)c62;
+        (void)c63;
+    #endif
+        while (last - p >= 4)
+        {
+            uint8_t a = reverse_alphabet[static_cast<uint8_t>(p[0])];
+            uint8_t b = reverse_alphabet[static_cast<uint8_t>(p[1])];
+            uint8_t c = reverse_alphabet[static_cast<uint8_t>(p[2])];
+            uint8_t d = reverse_alphabet[static_cast<uint8_t>(p[3])];
+            if ((a | b | c | d) == 0xff)
+            {
+                break;
+            }
+            dest[0] = static_cast<uint8_t>((a << 2) | (b >> 4));
+            dest[1] = static_cast<uint8_t>((b << 4) | (c >> 2));
+            dest[2] = static_cast<uint8_t>((c << 6) | d);
+            p += 4;
+            dest += 3;
+        }
+        return p;
+    }
+
+    // base16 kernels
 
-            a4[0] = (a3[0] & 0xfc) >> 2;
-            a4[1] = ((a3[0] & 0x03) << 4) + ((a3[1] & 0xf0) >> 4);
-            a4[2] = ((a3[1] & 0x0f) << 2) + ((a3[2] & 0xc0) >> 6);
+    inline
+    int hex_digit_value(char c)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        int lc = c | 0x20;
+        if (lc >= 'a' && lc <= 'f')
+        {
+            return lc - 'a' + 10;
+        }
+        return -1;
+    }
+
+    inline
+    char* encode_base16_block(const uint8_t* first, const uint8_t* last, char* dest)
+    {
+        static constexpr char characters[] = "0123456789ABCDEF";
 
-            for (j = 0; j < i + 1; ++j) 
+        const uint8_t* p = first;
+    #if defined(JSONCONS_HAS_SSE2)
+        while (last - p >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+            __m128i lo = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+            hi = _mm_add_epi8(_mm_add_epi8(hi, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(hi, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10)));
+            lo = _mm_add_epi8(_mm_add_epi8(lo, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(lo, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi8(hi, lo));
+            p += 16;
+            dest += 32;
+        }
+    #endif
+        for (; p != last; ++p)
+        {
+            *dest++ = characters[*p >> 4];
+            *dest++ = characters[*p & 0xf];
+        }
+        return dest;
+    }
+
+    // Decodes pairs of hexadecimal digits from [first,last) into dest, stopping before the first pair
+    // that holds some other character. Returns the first character not consumed and advances dest.
+
+    inline
+    const char* decode_base16_block(const char* first, const char* last, uint8_t*& dest)
+    {
+        const char* p = first;
+    #if defined(JSONCONS_HAS_SSE2)
+        while (last - p >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i lv = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+            __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lv, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lv, _mm_set1_epi8('f' + 1)));
+            if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xffff)
             {
-                result.push_back(alphabet[a4[j]]);
-                ++count;
+                break;
             }
+            __m128i values = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(v, _mm_set1_epi8('0'))), 
+                                          _mm_and_si128(letter, _mm_sub_epi8(lv, _mm_set1_epi8('a' - 10))));
+            __m128i bytes = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(values, 4), _mm_srli_epi16(values, 8)), _mm_set1_epi16(0x00ff));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dest), _mm_packus_epi16(bytes, bytes));
+            p += 16;
+            dest += 8;
+        }
+    #endif
+        while (last - p >= 2)
+        {
+            int hi = hex_digit_value(p[0]);
+            int lo = hex_digit_value(p[1]);
+            if (hi < 0 || lo < 0)
+            {
+                break;
+            }
+            *dest++ = static_cast<uint8_t>((hi << 4) | lo);
+            p += 2;
+        }
+        return p;
+    }
 
-            if (fill != 0)
+    // Drivers that pick the output strategy for the container
+
+    template <class Container>
+    typename std::enable_if<is_resizable_byte_buffer<Container>::value,std::size_t>::type
+    encode_base64_bytes(const uint8_t* first, const uint8_t* last, const char alphabet[65], Container& result)
+    {
+        std::size_t length = base64_encoded_size(static_cast<std::size_t>(last - first), alphabet[64] != 0);
+        if (length > 0)
+        {
+            std::size_t size = result.size();
+            result.resize(size + length);
+            encode_base64_block(first, last, alphabet, reinterpret_cast<char*>(&result[0]) + size);
+        }
+        return length;
+    }
+
+    template <class Container>
+    typename std::enable_if<!is_resizable_byte_buffer<Container>::value,std::size_t>::type
+    encode_base64_bytes(const uint8_t* first, const uint8_t* last, const char alphabet[65], Container& result)
+    {
+        char buffer[1024];
+        std::size_t count = 0;
+        const uint8_t* p = first;
+        do
+        {
+            const uint8_t* chunk_last = (last - p) > 768 ? p + 768 : last;
+            std::size_t length = encode_base64_block(p, chunk_last, alphabet, buffer) - buffer;
+            append_buffer(result, buffer, length);
+            count += length;
+            p = chunk_last;
+        }
+        while (p != last);
+        return count;
+    }
+
+    template <class Container>
+    typename std::enable_if<is_resizable_byte_buffer<Container>::value,std::size_t>::type
+    encode_base16_bytes(const uint8_t* first, const uint8_t* last, Container& result)
+    {
+        std::size_t length = static_cast<std::size_t>(last - first) * 2;
+        if (length > 0)
+        {
+            std::size_t size = result.size();
+            result.resize(size + length);
+            encode_base16_block(first, last, reinterpret_cast<char*>(&result[0]) + size);
+        }
+        return length;
+    }
+
+    template <class Container>
+    typename std::enable_if<!is_resizable_byte_buffer<Container>::value,std::size_t>::type
+    encode_base16_bytes(const uint8_t* first, const uint8_t* last, Container& result)
+    {
+        char buffer[1024];
+        const uint8_t* p = first;
+        while (p != last)
+        {
+            const uint8_t* chunk_last = (last - p) > 512 ? p + 512 : last;
+            std::size_t length = encode_base16_block(p, chunk_last, buffer) - buffer;
+            append_buffer(result, buffer, length);
+            p = chunk_last;
+        }
+        return static_cast<std::size_t>(last - first) * 2;
+    }
+
+    template <class Container, class Decode>
+    typename std::enable_if<is_resizable_byte_buffer<Container>::value,const char*>::type
+    decode_bytes(const char* first, const char* last, std::size_t max_length, Container& result, Decode decode)
+    {
+        if (max_length == 0)
+        {
+            return first;
+        }
+        std::size_t size = result.size();
+        result.resize(size + max_length);
+        uint8_t* start = reinterpret_cast<uint8_t*>(&result[0]) + size;
+        uint8_t* dest = start;
+        const char* p = decode(first, last, dest);
+        result.resize(size + (dest - start));
+        return p;
+    }
+
+    template <class Container, class Decode>
+    typename std::enable_if<!is_resizable_byte_buffer<Container>::value,const char*>::type
+    decode_bytes(const char* first, const char* last, std::size_t, Container& result, Decode decode)
+    {
+        uint8_t buffer[768];
+        const char* p = first;
+        while (p != last)
+        {
+            const char* chunk_last = (last - p) > 1024 ? p + 1024 : last;
+            uint8_t* dest = buffer;
+            const char* q = decode(p, chunk_last, dest);
+            append_buffer(result, buffer, dest - buffer);
+            if (q != chunk_last)
             {
-                while (i++ < 3) 
-                {
-                    result.push_back(fill);
-                    ++count;
-                }
+                return q;
+            }
+            p = q;
+        }
+        return p;
+    }
+
+    // Runs decode over the longest prefix of [first,last) it accepts and returns the position after it.
+    // Input that is not a contiguous or forward range of narrow characters is left to the caller.
+
+    template <class InputIt, class Container, class Decode>
+    typename std::enable_if<std::is_pointer<InputIt>::value && 
+                            sizeof(typename std::iterator_traits<InputIt>::value_type) == 1,InputIt>::type
+    decode_prefix(InputIt first, InputIt last, std::size_t group_size, std::size_t group_length, Container& result, Decode decode)
+    {
+        const char* p = reinterpret_cast<const char*>(first);
+        std::size_t length = static_cast<std::size_t>(last - first) / group_size * group_size;
+        const char* q = decode_bytes(p, p + length, length / group_size * group_length, result, decode);
+        return first + (q - p);
+    }
+
+    template <class InputIt, class Container, class Decode>
+    typename std::enable_if<!std::is_pointer<InputIt>::value && 
+                            std::is_base_of<std::forward_iterator_tag,typename std::iterator_traits<InputIt>::iterator_category>::value &&
+                            std::is_integral<typename std::iterator_traits<InputIt>::value_type>::value &&
+                            sizeof(typename std::iterator_traits<InputIt>::value_type) == 1,InputIt>::type
+    decode_prefix(InputIt first, InputIt last, std::size_t group_size, std::size_t group_length, Container& result, Decode decode)
+    {
+        char buffer[1024];
+        const std::size_t chunk_size = sizeof(buffer) / group_size * group_size;
+        while (first != last)
+        {
+            InputIt it = first;
+            std::size_t n = 0;
+            while (n < chunk_size && it != last)
+            {
+                buffer[n++] = static_cast<char>(*it++);
+            }
+            n = n / group_size * group_size;
+            const char* q = decode_bytes(buffer, buffer + n, n / group_size * group_length, result, decode);
+            std::advance(first, q - buffer);
+            if (q != buffer + chunk_size)
+            {
+                break;
             }
         }
+        return first;
+    }
+
+    template <class InputIt, class Container, class Decode>
+    typename std::enable_if<!std::is_pointer<InputIt>::value && 
+                            !(std::is_base_of<std::forward_iterator_tag,typename std::iterator_traits<InputIt>::iterator_category>::value &&
+                              std::is_integral<typename std::iterator_traits<InputIt>::value_type>::value &&
+                              sizeof(typename std::iterator_traits<InputIt>::value_type) == 1),InputIt>::type
+    decode_prefix(InputIt first, InputIt, std::size_t, std::size_t, Container&, Decode)
+    {
+        return first;
+    }
 
+    template <class InputIt, class Container>
+    std::size_t encode_base16_generic(InputIt first, InputIt last, Container& result, std::true_type)
+    {
+        return encode_base16_bytes(first, last, result);
+    }
+
+    template <class InputIt, class Container>
+    std::size_t encode_base16_generic(InputIt first, InputIt last, Container& result, std::false_type)
+    {
+        uint8_t buffer[512];
+        std::size_t count = 0;
+        while (first != last)
+        {
+            std::size_t n = 0;
+            while (n < sizeof(buffer) && first != last)
+            {
+                buffer[n++] = *first++;
+            }
+            count += encode_base16_bytes(buffer, buffer + n, result);
+        }
         return count;
     }
 
+    template <class InputIt, class Container>
+    std::size_t encode_base64_generic(InputIt first, InputIt last, const char alphabet[65], Container& result, std::true_type)
+    {
+        return encode_base64_bytes(first, last, alphabet, result);
+    }
+
+    template <class InputIt, class Container>
+    std::size_t encode_base64_generic(InputIt first, InputIt last, const char alphabet[65], Container& result, std::false_type)
+    {
+        uint8_t buffer[768];
+        std::size_t count = 0;
+        while (first != last)
+        {
+            std::size_t n = 0;
+            while (n < sizeof(buffer) && first != last)
+            {
+                buffer[n++] = *first++;
+            }
+            count += encode_base64_bytes(buffer, buffer + n, alphabet, result);
+        }
+        return count;
+    }
+
+    template <class InputIt, class Container>
+    typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
+    encode_base64_generic(InputIt first, InputIt last, const char alphabet[65], Container& result)
+    {
+        return encode_base64_generic(first, last, alphabet, result, std::is_pointer<InputIt>());
+    }
+
     template <class InputIt, class F, class Container>
     typename std::enable_if<extension_traits::is_back_insertable_byte_container<Container>::value,decode_result<InputIt>>::type 
     decode_base64_generic(InputIt first, InputIt last, 
                           const uint8_t reverse_alphabet[256],
+                          char c62, char c63,
                           F f,
                           Container& result)
     {
+        // Whole groups of four are decoded in bulk, the rest one character at a time
+        first = decode_prefix(first, last, 4, 3, result, 
+                              [reverse_alphabet,c62,c63](const char* p, const char* q, uint8_t*& dest)
+                              {
+                                  return decode_base64_block(p, q, reverse_alphabet, c62, c63, dest);
+                              });
+
         uint8_t a4[4], a3[3];
         uint8_t i = 0;
         uint8_t j = 0;
@@ -151,15 +601,7 @@ namespace detail {
     typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
     encode_base16(InputIt first, InputIt last, Container& result)
     {
-        static constexpr char characters[] = "0123456789ABCDEF";
-
-        for (auto it = first; it != last; ++it)
-        {
-            uint8_t c = *it;
-            result.push_back(characters[c >> 4]);
-            result.push_back(characters[c & 0xf]);
-        }
-        return (last-first)*2;
+        return detail::encode_base16_generic(first, last, result, std::is_pointer<InputIt>());
     }
 
     template <class InputIt, class Container>
@@ -226,7 +668,7 @@ namespace detail {
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
         };
-        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, 
+        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, '-', '_',
                                                               is_base64url<typename std::iterator_traits<InputIt>::value_type>, 
                                                               result);
         return retval.ec == conv_errc::success ? retval : decode_result<InputIt>{retval.it, conv_errc::not_base64url};
@@ -254,7 +696,7 @@ namespace detail {
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
         };
-        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, 
+        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, '+', '/',
                                                              is_base64<typename std::iterator_traits<InputIt>::value_type>, 
                                                              result);
         return retval.ec == conv_errc::success ? retval : decode_result<InputIt>{retval.it, conv_errc::not_base64};
@@ -270,7 +712,11 @@ namespace detail {
             return decode_result<InputIt>{first, conv_errc::not_base16};
         }
 
-        InputIt it = first;
+        InputIt it = detail::decode_prefix(first, last, 2, 1, result, 
+                                           [](const char* p, const char* q, uint8_t*& dest)
+                                           {
+                                               return detail::decode_base16_block(p, q, dest);
+                                           });
         while (it != last)
         {
             uint8_t val;
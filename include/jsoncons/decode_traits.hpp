@@ -21,6 +21,68 @@
 
 namespace jsoncons {
 
+    // skip_value_visitor
+
+    template <class CharT>
+    class skip_value_visitor : public basic_default_json_visitor<CharT>
+    {
+        std::size_t level_;
+    public:
+        skip_value_visitor()
+            : level_(0)
+        {
+        }
+    private:
+        bool visit_begin_object(semantic_tag, const ser_context&, std::error_code&) override
+        {
+            ++level_;
+            return true;
+        }
+
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            return --level_ != 0;
+        }
+
+        bool visit_begin_array(semantic_tag, const ser_context&, std::error_code&) override
+        {
+            ++level_;
+            return true;
+        }
+
+        bool visit_end_array(const ser_context&, std::error_code&) override
+        {
+            return --level_ != 0;
+        }
+    };
+
+    // Consumes the value that begins at the cursor's current event, so that
+    // the following next() moves past the whole value
+    template <class CharT>
+    void consume_value(basic_staj_cursor<CharT>& cursor, std::error_code& ec)
+    {
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::begin_object:
+            case staj_event_type::begin_array:
+            {
+                skip_value_visitor<CharT> visitor;
+                cursor.read_to(visitor, ec);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Moves the cursor past the value that begins at its current event,
+    // with skip(), so that containers are passed over without reporting their items
+    template <class CharT>
+    void skip_value(basic_staj_cursor<CharT>& cursor, std::error_code& ec)
+    {
+        cursor.skip(ec);
+    }
+
     // decode_traits
 
     template <class T, class CharT, class Enable = void>
@@ -0,0 +1,47 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_FNV1A_HPP
+#define JSONCONS_DETAIL_FNV1A_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::make_unsigned
+
+namespace jsoncons {
+namespace detail {
+
+    // FNV-1a hashes of the code units of a string, used by the key indexes and key tables
+
+    template <class CharT>
+    uint32_t fnv1a_32(const CharT* s, std::size_t length, uint32_t basis = 2166136261u) noexcept
+    {
+        uint32_t hash_value = basis;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            hash_value ^= static_cast<uint32_t>(static_cast<typename std::make_unsigned<CharT>::type>(s[i]));
+            hash_value *= 16777619u;
+        }
+        return hash_value;
+    }
+
+    // The 64 bit hash, with its high half folded into the low half so that any low bits make a good table slot
+    template <class CharT>
+    std::size_t fnv1a(const CharT* s, std::size_t length) noexcept
+    {
+        uint64_t hash_value = 14695981039346656037ull;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            hash_value ^= static_cast<uint64_t>(static_cast<typename std::make_unsigned<CharT>::type>(s[i]));
+            hash_value *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(hash_value ^ (hash_value >> 32));
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,634 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_HPP
+#define JSONCONS_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <type_traits>
+#include <jsoncons/config/compiler_support.hpp>
+
+// Vector paths are selected at compile time from the target flags, e.g. -msse2 (the default
+// on x86-64), -mssse3 or -mavx2. Define JSONCONS_NO_SIMD to restrict scanning to the portable SWAR path.
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__AVX2__)
+#    define JSONCONS_HAS_AVX2 1
+#  endif
+#  if defined(__SSSE3__) || defined(__AVX__)
+#    define JSONCONS_HAS_SSSE3 1
+#  endif
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#endif
+
+#if defined(JSONCONS_HAS_AVX2)
+#  include <immintrin.h>
+#elif defined(JSONCONS_HAS_SSSE3)
+#  include <tmmintrin.h>
+#elif defined(JSONCONS_HAS_SSE2)
+#  include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+    inline
+    int count_trailing_zeros(uint32_t mask)
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+    #elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+    #else
+        int n = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            ++n;
+        }
+        return n;
+    #endif
+    }
+
+    inline
+    int count_trailing_zeros(uint64_t mask)
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(mask);
+    #elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<int>(index);
+    #else
+        uint32_t lo = static_cast<uint32_t>(mask);
+        return lo != 0 ? count_trailing_zeros(lo) : 32 + count_trailing_zeros(static_cast<uint32_t>(mask >> 32));
+    #endif
+    }
+
+    namespace swar {
+
+        JSONCONS_CONSTEXPR inline uint64_t broadcast(uint8_t c)
+        {
+            return 0x0101010101010101ull * c;
+        }
+
+        inline uint64_t load(const char* p)
+        {
+            uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            return word;
+        }
+
+        // Nonzero iff some byte of word is zero
+        JSONCONS_CONSTEXPR inline uint64_t has_zero_byte(uint64_t word)
+        {
+            return (word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull;
+        }
+
+        // High bit set in exactly those bytes of word that are zero
+        JSONCONS_CONSTEXPR inline uint64_t zero_bytes(uint64_t word)
+        {
+            return ~(((word & 0x7f7f7f7f7f7f7f7full) + 0x7f7f7f7f7f7f7f7full) | word | 0x7f7f7f7f7f7f7f7full);
+        }
+
+        // Nonzero iff some byte of word is less than n, for n <= 128
+        JSONCONS_CONSTEXPR inline uint64_t has_byte_less_than(uint64_t word, uint8_t n)
+        {
+            return (word - broadcast(n)) & ~word & 0x8080808080808080ull;
+        }
+
+    } // namespace swar
+
+    // Returns a pointer to the first character in [first,last) that cannot be copied verbatim
+    // into a JSON string value, that is, a quotation mark, a reverse solidus or a control
+    // character, or last if there is none.
+
+    inline
+    const char* find_string_special(const char* first, const char* last)
+    {
+        const char* p = first;
+    #if defined(JSONCONS_HAS_AVX2)
+        {
+            const __m256i quote = _mm256_set1_epi8('\"');
+            const __m256i backslash = _mm256_set1_epi8('\\');
+            const __m256i control_max = _mm256_set1_epi8(0x1f);
+            while (last - p >= 32)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                                  _mm256_cmpeq_epi8(_mm256_max_epu8(v, control_max), control_max));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 32;
+            }
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        {
+            const __m128i quote = _mm_set1_epi8('\"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i control_max = _mm_set1_epi8(0x1f);
+            while (last - p >= 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                               _mm_cmpeq_epi8(_mm_max_epu8(v, control_max), control_max));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 16;
+            }
+        }
+    #endif
+        while (last - p >= 8)
+        {
+            uint64_t word = swar::load(p);
+            if ((swar::has_zero_byte(word ^ swar::broadcast('\"')) |
+                 swar::has_zero_byte(word ^ swar::broadcast('\\')) |
+                 swar::has_byte_less_than(word, 0x20)) != 0)
+            {
+                break;
+            }
+            p += 8;
+        }
+        while (p != last)
+        {
+            uint8_t c = static_cast<uint8_t>(*p);
+            if (c == '\"' || c == '\\' || c < 0x20)
+            {
+                break;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+    // Wide character input is scanned one character at a time by the caller
+
+    template <class CharT>
+    typename std::enable_if<!std::is_same<CharT,char>::value,const CharT*>::type
+    find_string_special(const CharT* first, const CharT*)
+    {
+        return first;
+    }
+
+    // Returns a pointer to the first character in [first,last) that a JSON encoder cannot copy
+    // verbatim, that is, a quotation mark, a reverse solidus, a control character or DEL, a solidus
+    // if escape_solidus is set, or any non-ASCII byte if escape_all_non_ascii is set, or last if
+    // there is none.
+
+    inline
+    const char* find_escape_special(const char* first, const char* last, 
+                                    bool escape_all_non_ascii, bool escape_solidus)
+    {
+        const char* p = first;
+    #if defined(JSONCONS_HAS_AVX2)
+        {
+            const __m256i quote = _mm256_set1_epi8('\"');
+            const __m256i backslash = _mm256_set1_epi8('\\');
+            const __m256i del = _mm256_set1_epi8(0x7f);
+            const __m256i control_max = _mm256_set1_epi8(0x1f);
+            const __m256i solidus = escape_solidus ? _mm256_set1_epi8('/') : quote;
+            const uint32_t non_ascii = escape_all_non_ascii ? 0xffffffffu : 0;
+            while (last - p >= 32)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                                  _mm256_or_si256(_mm256_cmpeq_epi8(v, del), _mm256_cmpeq_epi8(v, solidus)));
+                special = _mm256_or_si256(special, _mm256_cmpeq_epi8(_mm256_max_epu8(v, control_max), control_max));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special)) | 
+                                (static_cast<uint32_t>(_mm256_movemask_epi8(v)) & non_ascii);
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 32;
+            }
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        {
+            const __m128i quote = _mm_set1_epi8('\"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i del = _mm_set1_epi8(0x7f);
+            const __m128i control_max = _mm_set1_epi8(0x1f);
+            const __m128i solidus = escape_solidus ? _mm_set1_epi8('/') : quote;
+            const uint32_t non_ascii = escape_all_non_ascii ? 0xffffu : 0;
+            while (last - p >= 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                               _mm_or_si128(_mm_cmpeq_epi8(v, del), _mm_cmpeq_epi8(v, solidus)));
+                special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_max_epu8(v, control_max), control_max));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special)) | 
+                                (static_cast<uint32_t>(_mm_movemask_epi8(v)) & non_ascii);
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 16;
+            }
+        }
+    #endif
+        {
+            const uint64_t solidus = swar::broadcast(escape_solidus ? '/' : '\"');
+            const uint64_t non_ascii = escape_all_non_ascii ? 0x8080808080808080ull : 0;
+            while (last - p >= 8)
+            {
+                uint64_t word = swar::load(p);
+                if ((swar::has_zero_byte(word ^ swar::broadcast('\"')) |
+                     swar::has_zero_byte(word ^ swar::broadcast('\\')) |
+                     swar::has_zero_byte(word ^ swar::broadcast(0x7f)) |
+                     swar::has_zero_byte(word ^ solidus) |
+                     swar::has_byte_less_than(word, 0x20) |
+                     (word & non_ascii)) != 0)
+                {
+                    break;
+                }
+                p += 8;
+            }
+        }
+        while (p != last)
+        {
+            uint8_t c = static_cast<uint8_t>(*p);
+            if (c == '\"' || c == '\\' || c < 0x20 || c == 0x7f || (escape_solidus && c == '/') || (escape_all_non_ascii && c >= 0x80))
+            {
+                break;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+    // Wide character strings are escaped one character at a time by the caller
+
+    template <class CharT>
+    typename std::enable_if<!std::is_same<CharT,char>::value,const CharT*>::type
+    find_escape_special(const CharT* first, const CharT*, bool, bool)
+    {
+        return first;
+    }
+
+    // Returns a pointer to the first character in [first,last) that is neither a space nor
+    // a horizontal tab, or last if there is none.
+
+    inline
+    const char* skip_blanks(const char* first, const char* last)
+    {
+        const char* p = first;
+        // Most runs of blanks are short, check the next two characters before the block scan
+        for (int i = 0; i < 2; ++i)
+        {
+            if (p == last || (*p != ' ' && *p != '\t'))
+            {
+                return p;
+            }
+            ++p;
+        }
+    #if defined(JSONCONS_HAS_AVX2)
+        {
+            const __m256i space = _mm256_set1_epi8(' ');
+            const __m256i tab = _mm256_set1_epi8('\t');
+            while (last - p >= 32)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                __m256i blank = _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab));
+                uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(blank));
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 32;
+            }
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        {
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i tab = _mm_set1_epi8('\t');
+            while (last - p >= 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab));
+                uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(blank)) & 0xffff;
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 16;
+            }
+        }
+    #endif
+        while (last - p >= 8)
+        {
+            uint64_t word = swar::load(p);
+            if ((swar::zero_bytes(word ^ swar::broadcast(' ')) | swar::zero_bytes(word ^ swar::broadcast('\t'))) != 0x8080808080808080ull)
+            {
+                break;
+            }
+            p += 8;
+        }
+        while (p != last && (*p == ' ' || *p == '\t'))
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    template <class CharT>
+    typename std::enable_if<!std::is_same<CharT,char>::value,const CharT*>::type
+    skip_blanks(const CharT* first, const CharT* last)
+    {
+        const CharT* p = first;
+        while (p != last && (*p == ' ' || *p == '\t'))
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    // Returns a pointer to the first byte in [first,last) that is not ASCII, or last if there is none.
+
+    inline
+    const char* skip_ascii(const char* first, const char* last)
+    {
+        const char* p = first;
+    #if defined(JSONCONS_HAS_AVX2)
+        while (last - p >= 32)
+        {
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))));
+            if (mask != 0)
+            {
+                return p + count_trailing_zeros(mask);
+            }
+            p += 32;
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        while (last - p >= 16)
+        {
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+            if (mask != 0)
+            {
+                return p + count_trailing_zeros(mask);
+            }
+            p += 16;
+        }
+    #endif
+        while (last - p >= 8)
+        {
+            if ((swar::load(p) & 0x8080808080808080ull) != 0)
+            {
+                break;
+            }
+            p += 8;
+        }
+        while (p != last && static_cast<uint8_t>(*p) < 0x80)
+        {
+            ++p;
+        }
+        return p;
+    }
+
+#if defined(JSONCONS_HAS_SSSE3) || defined(JSONCONS_HAS_AVX2)
+
+    // Tables for validating UTF-8 a block at a time, after Keiser and Lemire, "Validating UTF-8 
+    // in less than one instruction per byte". Each error class is a bit, and a pair of adjacent
+    // bytes is in error when the classes looked up from the high and low nibbles of the first byte
+    // and the high nibble of the second byte have a bit in common.
+
+    namespace utf8_lookup {
+
+        enum : uint8_t
+        {
+            too_short = 1 << 0,      // 11______ 0_______, 11______ 11______
+            too_long = 1 << 1,       // 0_______ 10______
+            overlong_3 = 1 << 2,     // 11100000 100_____
+            too_large = 1 << 3,      // 11110100 1001____, 11110100 101_____, 11110101+ 10______
+            surrogate = 1 << 4,      // 11101101 101_____
+            overlong_2 = 1 << 5,     // 1100000_ 10______
+            too_large_1000 = 1 << 6, // 11110101+ 1000____
+            overlong_4 = 1 << 6,     // 11110000 1000____
+            two_conts = 1 << 7,      // 10______ 10______
+            carry = too_short | too_long | two_conts
+        };
+
+        inline
+        const uint8_t* byte_1_high()
+        {
+            static const uint8_t table[16] = {
+                too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                two_conts, two_conts, two_conts, two_conts,
+                too_short | overlong_2,
+                too_short,
+                too_short | overlong_3 | surrogate,
+                too_short | too_large | too_large_1000 | overlong_4
+            };
+            return table;
+        }
+
+        inline
+        const uint8_t* byte_1_low()
+        {
+            static const uint8_t table[16] = {
+                carry | overlong_3 | overlong_2 | overlong_4,
+                carry | overlong_2,
+                carry,
+                carry,
+                carry | too_large,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000 | surrogate,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000
+            };
+            return table;
+        }
+
+        inline
+        const uint8_t* byte_2_high()
+        {
+            static const uint8_t table[16] = {
+                too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+                too_long | overlong_2 | two_conts | overlong_3 | too_large,
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                too_short, too_short, too_short, too_short
+            };
+            return table;
+        }
+
+        // A block ends in an incomplete character when one of its last three bytes exceeds these
+        inline
+        const uint8_t* incomplete_max()
+        {
+            static const uint8_t table[32] = {
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+            };
+            return table;
+        }
+
+    } // namespace utf8_lookup
+
+#endif
+
+#if defined(JSONCONS_HAS_AVX2)
+
+    inline
+    __m256i utf8_block_errors(__m256i input, __m256i prev_input)
+    {
+        const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+        const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+        __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+        __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+        __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+        __m256i byte_1_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_1_high()))),
+                                                  _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+        __m256i byte_1_low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_1_low()))),
+                                                 _mm256_and_si256(prev1, low_nibble));
+        __m256i byte_2_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_2_high()))),
+                                                  _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+        __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+        // The third and fourth bytes of three and four byte characters must be continuations
+        __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), 
+                                                        _mm256_set1_epi8(static_cast<char>(0x80)));
+        return _mm256_xor_si256(must_be_continuation, special_cases);
+    }
+
+#elif defined(JSONCONS_HAS_SSSE3)
+
+    inline
+    __m128i utf8_block_errors(__m128i input, __m128i prev_input)
+    {
+        const __m128i low_nibble = _mm_set1_epi8(0x0f);
+        __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+        __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+        __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+        __m128i byte_1_high = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_1_high())),
+                                               _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+        __m128i byte_1_low = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_1_low())),
+                                              _mm_and_si128(prev1, low_nibble));
+        __m128i byte_2_high = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::byte_2_high())),
+                                               _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+        __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+        // The third and fourth bytes of three and four byte characters must be continuations
+        __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), 
+                                                     _mm_set1_epi8(static_cast<char>(0x80)));
+        return _mm_xor_si128(must_be_continuation, special_cases);
+    }
+
+#endif
+
+    // Returns a pointer p such that [first,p) is valid UTF-8 and p is the first byte of a character,
+    // so that the caller can validate [p,last) a character at a time. With AVX2 or SSSE3 everything
+    // but a short tail is checked a block at a time. Otherwise, or if a block is found to be in 
+    // error, only the leading run of ASCII is skipped, and the caller locates the error.
+
+    inline
+    const char* skip_valid_utf8(const char* first, const char* last)
+    {
+    #if defined(JSONCONS_HAS_AVX2)
+        const char* p = first;
+        const __m256i max = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf8_lookup::incomplete_max()));
+        __m256i prev_input = _mm256_setzero_si256();
+        __m256i prev_incomplete = _mm256_setzero_si256();
+        __m256i error = _mm256_setzero_si256();
+        while (last - p >= 32)
+        {
+            __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            if (_mm256_movemask_epi8(input) == 0)
+            {
+                error = _mm256_or_si256(error, prev_incomplete);
+                prev_incomplete = _mm256_setzero_si256();
+            }
+            else
+            {
+                error = _mm256_or_si256(error, utf8_block_errors(input, prev_input));
+                prev_incomplete = _mm256_subs_epu8(input, max);
+            }
+            prev_input = input;
+            p += 32;
+        }
+        if (!_mm256_testz_si256(error, error))
+        {
+            return skip_ascii(first, last);
+        }
+    #elif defined(JSONCONS_HAS_SSSE3)
+        const char* p = first;
+        const __m128i max = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_lookup::incomplete_max() + 16));
+        __m128i prev_input = _mm_setzero_si128();
+        __m128i prev_incomplete = _mm_setzero_si128();
+        __m128i error = _mm_setzero_si128();
+        while (last - p >= 16)
+        {
+            __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            if (_mm_movemask_epi8(input) == 0)
+            {
+                error = _mm_or_si128(error, prev_incomplete);
+                prev_incomplete = _mm_setzero_si128();
+            }
+            else
+            {
+                error = _mm_or_si128(error, utf8_block_errors(input, prev_input));
+                prev_incomplete = _mm_subs_epu8(input, max);
+            }
+            prev_input = input;
+            p += 16;
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xffff)
+        {
+            return skip_ascii(first, last);
+        }
+    #else
+        const char* p = skip_ascii(first, last);
+    #endif
+        // Back up to the first byte of the last character, which may continue past p
+        for (int i = 0; i < 3 && p != first && (static_cast<uint8_t>(p[-1]) & 0xc0) == 0x80; ++i)
+        {
+            --p;
+        }
+        if (p != first && static_cast<uint8_t>(p[-1]) >= 0xc0)
+        {
+            --p;
+        }
+        return p;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
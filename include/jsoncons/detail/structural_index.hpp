@@ -0,0 +1,533 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+#define JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <limits> // std::numeric_limits
+#include <type_traits>
+#include <jsoncons/detail/simd.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Whether the text that starts at p looks indented, judged by the share of blanks in its
+    // first sample_length characters. The second stage stops at every structural character
+    // and token, so it gains on text with runs of blanks to pass over, and loses to the
+    // regular parser on compact text, where almost every character starts or ends a token.
+    template <class CharT>
+    bool is_indented_text(const CharT* p, const CharT* end) noexcept
+    {
+        const std::size_t sample_length = 512;
+        const std::size_t length = static_cast<std::size_t>(end - p) < sample_length ? static_cast<std::size_t>(end - p) : sample_length;
+        std::size_t blanks = 0;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            switch (p[i])
+            {
+                case ' ':case '\t':case '\n':case '\r':
+                    ++blanks;
+                    break;
+                default:
+                    break;
+            }
+        }
+        // At least one character in four
+        return 4*blanks >= length;
+    }
+
+    // Character classes of a 64 byte block, one bit per byte
+    struct structural_block
+    {
+        uint64_t quote;
+        uint64_t backslash;
+        uint64_t control;
+        uint64_t whitespace;
+        uint64_t newline;
+        uint64_t op;
+    };
+
+    inline
+    void classify_block(const char* p, structural_block& block)
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control_max = _mm_set1_epi8(0x1f);
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i lf = _mm_set1_epi8('\n');
+        const __m128i cr = _mm_set1_epi8('\r');
+        const __m128i lbrace = _mm_set1_epi8('{');
+        const __m128i rbrace = _mm_set1_epi8('}');
+        const __m128i lbracket = _mm_set1_epi8('[');
+        const __m128i rbracket = _mm_set1_epi8(']');
+        const __m128i colon = _mm_set1_epi8(':');
+        const __m128i comma = _mm_set1_epi8(',');
+
+        block = structural_block{0,0,0,0,0,0};
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            __m128i newline = _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr));
+            __m128i whitespace = _mm_or_si128(newline, _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)));
+            __m128i op = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, rbrace)),
+                                      _mm_or_si128(_mm_cmpeq_epi8(v, lbracket), _mm_cmpeq_epi8(v, rbracket)));
+            op = _mm_or_si128(op, _mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma)));
+
+            int shift = 16*i;
+            block.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)))) << shift;
+            block.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)))) << shift;
+            block.control |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, control_max), control_max)))) << shift;
+            block.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(whitespace))) << shift;
+            block.newline |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(newline))) << shift;
+            block.op |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(op))) << shift;
+        }
+    #else
+        block = structural_block{0,0,0,0,0,0};
+        for (int i = 0; i < 64; ++i)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            uint8_t c = static_cast<uint8_t>(p[i]);
+            switch (c)
+            {
+                case '\"':
+                    block.quote |= bit;
+                    break;
+                case '\\':
+                    block.backslash |= bit;
+                    break;
+                case '\n': case '\r':
+                    block.newline |= bit;
+                    block.whitespace |= bit;
+                    block.control |= bit;
+                    break;
+                case '\t':
+                    block.whitespace |= bit;
+                    block.control |= bit;
+                    break;
+                case ' ':
+                    block.whitespace |= bit;
+                    break;
+                case '{': case '}': case '[': case ']': case ':': case ',':
+                    block.op |= bit;
+                    break;
+                default:
+                    if (c < 0x20)
+                    {
+                        block.control |= bit;
+                    }
+                    break;
+            }
+        }
+    #endif
+    }
+
+    // Bit i of the result is set if byte i is preceded by an unescaped reverse solidus.
+    // Runs of reverse solidus characters are rare, so they are walked one at a time.
+    inline
+    uint64_t escaped_bits(uint64_t backslash, uint64_t& prev_escaped)
+    {
+        uint64_t escaped = prev_escaped;
+        backslash &= ~prev_escaped;
+        prev_escaped = 0;
+        while (backslash != 0)
+        {
+            int i = count_trailing_zeros(backslash);
+            if (i == 63)
+            {
+                prev_escaped = 1;
+                break;
+            }
+            escaped |= uint64_t(1) << (i+1);
+            backslash &= ~(uint64_t(3) << i);
+        }
+        return escaped;
+    }
+
+    // Bit i of the result is the parity of the bits at positions 0 to i
+    JSONCONS_CPP14_CONSTEXPR inline uint64_t prefix_xor(uint64_t bits)
+    {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+    // Stage one of the two stage parse. Records the offsets of every character that the second
+    // stage stops at. Outside strings these are the structural characters {}[]:, line breaks,
+    // quotation marks that open strings, and the first character of every other token. Inside
+    // strings they are the closing quotation mark, and any reverse solidus or control character,
+    // which tell the second stage that the string needs the full string parser.
+    //
+    // The input is scanned a window at a time, so that the index stays small enough to be
+    // in cache when the second stage reads it. Whether the scan is inside a string, or an escape,
+    // or a token, is carried from one window to the next.
+
+    class structural_scanner
+    {
+        uint64_t prev_escaped_;
+        uint64_t prev_in_string_;
+        uint64_t prev_scalar_;
+    public:
+        structural_scanner()
+            : prev_escaped_(0), prev_in_string_(0), prev_scalar_(0)
+        {
+        }
+
+        // Starts a scan at a character that is outside a string
+        void reset()
+        {
+            prev_escaped_ = 0;
+            prev_in_string_ = 0;
+            prev_scalar_ = 0;
+        }
+
+        // Stores the offsets, relative to first, of the characters in [first,last) in index, and 
+        // sets count to the number stored. index must have room for (last - first) + 64 offsets. 
+        // The window must continue the input of the previous call, and the length of every window 
+        // but the last must be a multiple of 64. Returns false if the input cannot be indexed.
+        bool scan(const char* first, const char* last, uint32_t* index, std::size_t& count)
+        {
+            count = 0;
+            std::size_t length = static_cast<std::size_t>(last - first);
+            if (length > (std::numeric_limits<uint32_t>::max)())
+            {
+                return false;
+            }
+
+            structural_block block;
+            for (std::size_t offset = 0; offset < length; offset += 64)
+            {
+                std::size_t n = length - offset;
+                if (n >= 64)
+                {
+                    classify_block(first + offset, block);
+                }
+                else
+                {
+                    char buf[64];
+                    std::memcpy(buf, first + offset, n);
+                    std::memset(buf + n, ' ', 64 - n);
+                    classify_block(buf, block);
+                }
+
+                uint64_t quote = block.quote & ~escaped_bits(block.backslash, prev_escaped_);
+                uint64_t in_string = prefix_xor(quote) ^ prev_in_string_; // includes the opening quote
+                prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+                uint64_t scalar = ~(block.whitespace | block.op | quote | in_string);
+                uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar_);
+                prev_scalar_ = scalar >> 63;
+
+                uint64_t bits = ((block.op | block.newline) & ~in_string) | quote | scalar_start |
+                                ((block.backslash | block.control) & in_string);
+                if (n < 64)
+                {
+                    bits &= (uint64_t(1) << n) - 1;
+                }
+                // A block adds at most 64 offsets, so they are stored without checking capacity 
+                // bit by bit
+                uint32_t* out = index + count;
+                while (bits != 0)
+                {
+                    *out++ = static_cast<uint32_t>(offset + count_trailing_zeros(bits));
+                    bits &= bits - 1;
+                }
+                count = static_cast<std::size_t>(out - index);
+            }
+            return true;
+        }
+
+        // Wide character input is not indexed
+
+        template <class CharT>
+        typename std::enable_if<!std::is_same<CharT,char>::value,bool>::type
+        scan(const CharT*, const CharT*, uint32_t*, std::size_t& count)
+        {
+            count = 0;
+            return false;
+        }
+    };
+
+    // Character classes used to find the end of a nested value, one bit per byte
+    struct skip_block
+    {
+        uint64_t quote;
+        uint64_t backslash;
+        uint64_t open;
+        uint64_t close;
+        uint64_t lf;
+        uint64_t cr;
+    };
+
+    inline
+    void classify_skip_block(const char* p, skip_block& block)
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i lf = _mm_set1_epi8('\n');
+        const __m128i cr = _mm_set1_epi8('\r');
+        const __m128i lbrace = _mm_set1_epi8('{');
+        const __m128i rbrace = _mm_set1_epi8('}');
+        const __m128i lbracket = _mm_set1_epi8('[');
+        const __m128i rbracket = _mm_set1_epi8(']');
+
+        block = skip_block{0,0,0,0,0,0};
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            __m128i open = _mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, lbracket));
+            __m128i close = _mm_or_si128(_mm_cmpeq_epi8(v, rbrace), _mm_cmpeq_epi8(v, rbracket));
+
+            int shift = 16*i;
+            block.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)))) << shift;
+            block.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)))) << shift;
+            block.open |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(open))) << shift;
+            block.close |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(close))) << shift;
+            block.lf |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, lf)))) << shift;
+            block.cr |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, cr)))) << shift;
+        }
+    #else
+        block = skip_block{0,0,0,0,0,0};
+        for (int i = 0; i < 64; ++i)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            switch (p[i])
+            {
+                case '\"':
+                    block.quote |= bit;
+                    break;
+                case '\\':
+                    block.backslash |= bit;
+                    break;
+                case '{': case '[':
+                    block.open |= bit;
+                    break;
+                case '}': case ']':
+                    block.close |= bit;
+                    break;
+                case '\n':
+                    block.lf |= bit;
+                    break;
+                case '\r':
+                    block.cr |= bit;
+                    break;
+                default:
+                    break;
+            }
+        }
+    #endif
+    }
+
+    // Finds the end of an array or object without parsing its contents. Brackets inside strings are
+    // told apart with the same quote and escape masks as the structural scan. Line breaks are counted
+    // so that the parser can keep its line and column. Input may arrive in pieces of any length.
+
+    class structure_skipper
+    {
+        uint64_t prev_escaped_;
+        uint64_t prev_in_string_;
+        bool prev_cr_;
+        std::size_t depth_;
+        std::size_t line_breaks_;
+        std::size_t line_start_;
+    public:
+        structure_skipper()
+            : prev_escaped_(0), prev_in_string_(0), prev_cr_(false), depth_(0), line_breaks_(0), line_start_(0)
+        {
+        }
+
+        // Starts a skip just after the opening bracket of a value
+        void reset()
+        {
+            prev_escaped_ = 0;
+            prev_in_string_ = 0;
+            prev_cr_ = false;
+            depth_ = 1;
+        }
+
+        // Number of line breaks in the input consumed by the last call to skip
+        std::size_t line_breaks() const
+        {
+            return line_breaks_;
+        }
+
+        // Offset, from the first character of the last call to skip, of the start of the last line.
+        // Meaningful only if line_breaks() is not zero.
+        std::size_t line_start() const
+        {
+            return line_start_;
+        }
+
+        // Returns the number of characters consumed. If the closing bracket was found, it is the
+        // last of them and done() is true.
+        std::size_t skip(const char* first, const char* last)
+        {
+            line_breaks_ = 0;
+            line_start_ = 0;
+
+            std::size_t length = static_cast<std::size_t>(last - first);
+            skip_block block;
+            for (std::size_t offset = 0; offset < length; offset += 64)
+            {
+                std::size_t n = length - offset;
+                if (n >= 64)
+                {
+                    classify_skip_block(first + offset, block);
+                    n = 64;
+                }
+                else
+                {
+                    char buf[64];
+                    std::memcpy(buf, first + offset, n);
+                    std::memset(buf + n, ' ', 64 - n);
+                    classify_skip_block(buf, block);
+                }
+
+                uint64_t escaped = escaped_bits(block.backslash, prev_escaped_);
+                if (n < 64 && ((escaped >> n) & 1))
+                {
+                    prev_escaped_ = 1; // the last character is an unescaped reverse solidus
+                }
+                uint64_t quote = block.quote & ~escaped;
+                uint64_t in_string = prefix_xor(quote) ^ prev_in_string_;
+                prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+                uint64_t open = block.open & ~in_string;
+                uint64_t close = block.close & ~in_string;
+                uint64_t last_bit = uint64_t(1) << (n - 1);
+
+                // A carriage return is a line break unless a line feed follows it. One that ends
+                // the input is decided by the next character.
+                if (prev_cr_ && !(block.lf & 1))
+                {
+                    ++line_breaks_;
+                    line_start_ = offset;
+                }
+                uint64_t breaks = block.lf | (block.cr & ~(block.lf >> 1) & ~last_bit);
+                prev_cr_ = (block.cr & last_bit) != 0;
+
+                uint64_t brackets = open | close;
+                while (brackets != 0)
+                {
+                    uint64_t bit = brackets & (0 - brackets);
+                    if (open & bit)
+                    {
+                        ++depth_;
+                    }
+                    else if (--depth_ == 0)
+                    {
+                        prev_cr_ = false;
+                        add_line_breaks(breaks & (bit - 1), offset);
+                        return offset + count_trailing_zeros(bit) + 1;
+                    }
+                    brackets &= brackets - 1;
+                }
+                add_line_breaks(breaks, offset);
+            }
+            return length;
+        }
+
+        // Character by character version for wide characters
+        template <class CharT>
+        typename std::enable_if<!std::is_same<CharT,char>::value,std::size_t>::type
+        skip(const CharT* first, const CharT* last)
+        {
+            line_breaks_ = 0;
+            line_start_ = 0;
+
+            bool in_string = prev_in_string_ != 0;
+            bool escaped = prev_escaped_ != 0;
+            for (const CharT* p = first; p != last; ++p)
+            {
+                CharT c = *p;
+                if (prev_cr_ && c != '\n')
+                {
+                    ++line_breaks_;
+                    line_start_ = static_cast<std::size_t>(p - first);
+                }
+                prev_cr_ = false;
+                if (in_string)
+                {
+                    if (escaped)
+                    {
+                        escaped = false;
+                    }
+                    else if (c == '\\')
+                    {
+                        escaped = true;
+                    }
+                    else if (c == '\"')
+                    {
+                        in_string = false;
+                    }
+                    else if (c == '\n')
+                    {
+                        ++line_breaks_;
+                        line_start_ = static_cast<std::size_t>(p - first) + 1;
+                    }
+                    continue;
+                }
+                switch (c)
+                {
+                    case '\"':
+                        in_string = true;
+                        break;
+                    case '{': case '[':
+                        ++depth_;
+                        break;
+                    case '}': case ']':
+                        if (--depth_ == 0)
+                        {
+                            prev_in_string_ = 0;
+                            prev_escaped_ = 0;
+                            return static_cast<std::size_t>(p - first) + 1;
+                        }
+                        break;
+                    case '\n':
+                        ++line_breaks_;
+                        line_start_ = static_cast<std::size_t>(p - first) + 1;
+                        break;
+                    case '\r':
+                        prev_cr_ = true;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            prev_in_string_ = in_string ? ~uint64_t(0) : 0;
+            prev_escaped_ = escaped ? 1 : 0;
+            return static_cast<std::size_t>(last - first);
+        }
+
+        bool done() const
+        {
+            return depth_ == 0;
+        }
+    private:
+        void add_line_breaks(uint64_t breaks, std::size_t offset)
+        {
+            while (breaks != 0)
+            {
+                ++line_breaks_;
+                line_start_ = offset + count_trailing_zeros(breaks) + 1;
+                breaks &= breaks - 1;
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
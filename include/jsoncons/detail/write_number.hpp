@@ -16,7 +16,7 @@
 #include <stdio.h> // snprintf
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_options.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/detail/schubfach.hpp>
 #include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons/extension_traits.hpp>
 
@@ -283,7 +283,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_scientific(double val, char decimal_point, Result& result)
+    bool dtoa_scientific(double val, char decimal_point, Result& result, std::false_type)
     {
         if (val == 0)
         {
@@ -315,6 +315,32 @@ namespace detail {
         return true;
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char, Result& result, std::true_type)
+    {
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+
+        int length = 0;
+        int k;
+
+        char buffer[20];
+
+        double u = std::signbit(v) ? -v : v;
+        jsoncons::detail::schubfach(u, buffer, &length, &k);
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        jsoncons::detail::prettify_string(buffer, length, k, (std::numeric_limits<int>::max)(), std::numeric_limits<int>::lowest(), result);
+        return true;
+    }
+
     template<class Result>
     bool dtoa_general(double val, char decimal_point, Result& result, std::false_type)
     {
@@ -349,7 +375,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_general(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_general(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -362,24 +388,18 @@ namespace detail {
         int length = 0;
         int k;
 
-        char buffer[100];
+        char buffer[20];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::schubfach(u, buffer, &length, &k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            // min exp: -4 is consistent with sprintf
-            // max exp: std::numeric_limits<double>::max_digits10
-            jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-            return true;
-        }
-        else
-        {
-            return dtoa_general(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        // min exp: -4 is consistent with sprintf
+        // max exp: std::numeric_limits<double>::max_digits10
+        jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
+        return true;
     }
 
     template<class Result>
@@ -416,7 +436,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_fixed(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_fixed(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -429,22 +449,16 @@ namespace detail {
         int length = 0;
         int k;
 
-        char buffer[100];
+        char buffer[20];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::schubfach(u, buffer, &length, &k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-            return true;
-        }
-        else
-        {
-            return dtoa_fixed(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
+        return true;
     }
 
     template<class Result>
@@ -453,6 +467,12 @@ namespace detail {
         return dtoa_fixed(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
     template<class Result>
     bool dtoa_general(double v, char decimal_point, Result& result)
     {
@@ -11,6 +11,7 @@
 #include <tuple>
 #include <array>
 #include <memory>
+#include <iterator> // std::distance
 #include <type_traits> // std::enable_if, std::true_type, std::false_type
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_decoder.hpp>
@@ -254,7 +255,7 @@ namespace jsoncons {
                            const Json& proto, 
                            std::error_code& ec)
         {
-            encoder.begin_array(val.size(),semantic_tag::none,ser_context(),ec);
+            encoder.begin_array(size(val),semantic_tag::none,ser_context(),ec);
             if (ec) return;
             for (auto it = std::begin(val); it != std::end(val); ++it)
             {
@@ -263,6 +264,21 @@ namespace jsoncons {
             }
             encoder.end_array(ser_context(), ec);
         }
+    private:
+        template <class Container>
+        static typename std::enable_if<extension_traits::has_size<Container>::value,std::size_t>::type
+        size(const Container& val)
+        {
+            return val.size();
+        }
+
+        // e.g. std::forward_list
+        template <class Container>
+        static typename std::enable_if<!extension_traits::has_size<Container>::value,std::size_t>::type
+        size(const Container& val)
+        {
+            return static_cast<std::size_t>(std::distance(std::begin(val), std::end(val)));
+        }
     };
 
     template <class T, class CharT>
@@ -472,6 +472,14 @@ namespace extension_traits {
     using
     container_data_t = decltype(std::declval<Container>().data());
 
+    template<class Container>
+    using
+    container_resize_t = decltype(std::declval<Container>().resize(typename Container::size_type()));
+
+    template<class Container>
+    using
+    container_append_t = decltype(std::declval<Container>().append(std::declval<const typename Container::value_type*>(), std::size_t()));
+
     template<class Container>
     using
     container_size_t = decltype(std::declval<Container>().size());
@@ -591,6 +599,18 @@ namespace extension_traits {
     using
     is_insertable = is_detected<container_insert_t, Container>;
 
+    // has_resize
+
+    template<class Container>
+    using
+    has_resize = is_detected<container_resize_t, Container>;
+
+    // has_append
+
+    template<class Container>
+    using
+    has_append = is_detected<container_append_t, Container>;
+
     // has_data, has_data_exact
 
     template<class Container>
@@ -0,0 +1,604 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_INTERNED_KEY_HPP
+#define JSONCONS_INTERNED_KEY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator
+#include <ostream>
+#include <string>
+#include <type_traits> // std::is_pointer
+#include <utility> // std::swap
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/heap_string.hpp>
+#include <jsoncons/detail/fnv1a.hpp>
+
+namespace jsoncons {
+
+    template <class CharT, class CharTraits, class Allocator>
+    class basic_key_intern_table;
+
+namespace detail {
+
+    // The reference count of an interned key, and the table that interned it. The table
+    // is atomic because a table that is cleared or destroyed resets it in strings that
+    // documents on other threads may be comparing.
+    struct interned_key_extra
+    {
+        std::atomic<std::size_t> refs;
+        std::atomic<const void*> table;
+
+        interned_key_extra(const void* tbl) noexcept
+            : refs(1), table(tbl)
+        {
+        }
+
+        interned_key_extra(const interned_key_extra& other) noexcept
+            : refs(other.refs.load(std::memory_order_relaxed)), table(other.table.load(std::memory_order_relaxed))
+        {
+        }
+    };
+
+} // namespace detail
+
+    // basic_interned_key
+
+    // An immutable string that shares its characters with all copies of it. Keys made by one
+    // basic_key_intern_table share one string for equal text, so that a key repeated across the
+    // objects of a document costs one pointer, and two keys of the same table are equal
+    // if and only if they point to the same string.
+
+    template <class CharT, class CharTraits = std::char_traits<CharT>, class Allocator = std::allocator<CharT>>
+    class basic_interned_key
+    {
+        friend class basic_key_intern_table<CharT,CharTraits,Allocator>;
+    public:
+        using value_type = CharT;
+        using traits_type = CharTraits;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+        using string_view_type = jsoncons::basic_string_view<CharT,CharTraits>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+    private:
+        using heap_string_factory_type = detail::heap_string_factory<CharT,detail::interned_key_extra,Allocator>;
+        using pointer = typename heap_string_factory_type::pointer;
+
+        pointer ptr_;
+
+        // Adopts a string with a reference already counted
+        explicit basic_interned_key(pointer ptr) noexcept
+            : ptr_(ptr)
+        {
+        }
+    public:
+        basic_interned_key() noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        explicit basic_interned_key(const Allocator&) noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        basic_interned_key(const CharT* s, size_type length, const Allocator& alloc = Allocator())
+            : ptr_(create(s, length, nullptr, alloc))
+        {
+        }
+
+        basic_interned_key(const CharT* s, const Allocator& alloc = Allocator())
+            : ptr_(create(s, CharTraits::length(s), nullptr, alloc))
+        {
+        }
+
+        explicit basic_interned_key(const string_view_type& s, const Allocator& alloc = Allocator())
+            : ptr_(create(s.data(), s.size(), nullptr, alloc))
+        {
+        }
+
+        template <class StringAllocator>
+        basic_interned_key(const std::basic_string<CharT,CharTraits,StringAllocator>& s, const Allocator& alloc = Allocator())
+            : ptr_(create(s.data(), s.size(), nullptr, alloc))
+        {
+        }
+
+        template <class InputIt>
+        basic_interned_key(InputIt first, InputIt last, const Allocator& alloc = Allocator(),
+                           typename std::enable_if<std::is_pointer<InputIt>::value,int>::type = 0)
+            : ptr_(create(first, static_cast<size_type>(last - first), nullptr, alloc))
+        {
+        }
+
+        template <class InputIt>
+        basic_interned_key(InputIt first, InputIt last, const Allocator& alloc = Allocator(),
+                           typename std::enable_if<!std::is_pointer<InputIt>::value && !std::is_integral<InputIt>::value,int>::type = 0)
+            : ptr_(nullptr)
+        {
+            std::basic_string<CharT,CharTraits,Allocator> s(first, last, alloc);
+            ptr_ = create(s.data(), s.size(), nullptr, alloc);
+        }
+
+        basic_interned_key(const basic_interned_key& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            add_ref();
+        }
+
+        basic_interned_key(const basic_interned_key& other, const Allocator& alloc)
+            : ptr_(nullptr)
+        {
+            if (other.ptr_ != nullptr && other.ptr_->get_allocator() == alloc)
+            {
+                ptr_ = other.ptr_;
+                add_ref();
+            }
+            else if (other.ptr_ != nullptr)
+            {
+                ptr_ = create(other.data(), other.size(), nullptr, alloc);
+            }
+        }
+
+        basic_interned_key(basic_interned_key&& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        basic_interned_key(basic_interned_key&& other, const Allocator& alloc)
+            : ptr_(nullptr)
+        {
+            if (other.ptr_ != nullptr && other.ptr_->get_allocator() == alloc)
+            {
+                ptr_ = other.ptr_;
+                other.ptr_ = nullptr;
+            }
+            else if (other.ptr_ != nullptr)
+            {
+                ptr_ = create(other.data(), other.size(), nullptr, alloc);
+            }
+        }
+
+        ~basic_interned_key() noexcept
+        {
+            release(ptr_);
+        }
+
+        basic_interned_key& operator=(const basic_interned_key& other) noexcept
+        {
+            basic_interned_key temp(other);
+            swap(temp);
+            return *this;
+        }
+
+        basic_interned_key& operator=(basic_interned_key&& other) noexcept
+        {
+            basic_interned_key temp(std::move(other));
+            swap(temp);
+            return *this;
+        }
+
+        const CharT* data() const noexcept
+        {
+            return ptr_ != nullptr ? ptr_->data() : empty_string();
+        }
+
+        const CharT* c_str() const noexcept
+        {
+            return data();
+        }
+
+        size_type size() const noexcept
+        {
+            return ptr_ != nullptr ? ptr_->length() : 0;
+        }
+
+        size_type length() const noexcept
+        {
+            return size();
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        CharT operator[](size_type i) const noexcept
+        {
+            return data()[i];
+        }
+
+        int compare(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_ ? 0 : string_view_type(*this).compare(string_view_type(other));
+        }
+
+        int compare(const string_view_type& s) const noexcept
+        {
+            return string_view_type(*this).compare(s);
+        }
+
+        int compare(const CharT* s) const noexcept
+        {
+            return string_view_type(*this).compare(s);
+        }
+
+        void swap(basic_interned_key& other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+        }
+
+        operator string_view_type() const noexcept
+        {
+            return string_view_type(data(), size());
+        }
+
+        template <class StringAllocator>
+        explicit operator std::basic_string<CharT,CharTraits,StringAllocator>() const
+        {
+            return std::basic_string<CharT,CharTraits,StringAllocator>(data(), size());
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            if (lhs.ptr_ == rhs.ptr_)
+            {
+                return true;
+            }
+            if (lhs.ptr_ != nullptr && rhs.ptr_ != nullptr)
+            {
+                const void* table = lhs.ptr_->extra_.table.load(std::memory_order_relaxed);
+                if (table != nullptr && table == rhs.ptr_->extra_.table.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+            }
+            return string_view_type(lhs) == string_view_type(rhs);
+        }
+        friend bool operator==(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return string_view_type(lhs) == rhs;
+        }
+        friend bool operator==(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs == string_view_type(rhs);
+        }
+        friend bool operator==(const basic_interned_key& lhs, const CharT* rhs) noexcept
+        {
+            return string_view_type(lhs) == string_view_type(rhs);
+        }
+        friend bool operator==(const CharT* lhs, const basic_interned_key& rhs) noexcept
+        {
+            return string_view_type(lhs) == string_view_type(rhs);
+        }
+
+        friend bool operator!=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const CharT* rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const CharT* lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+        friend bool operator<(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+        friend bool operator<(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) > 0;
+        }
+
+        friend bool operator<=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+        friend bool operator<=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+        friend bool operator<=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) >= 0;
+        }
+
+        friend bool operator>(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) > 0;
+        }
+        friend bool operator>(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) > 0;
+        }
+        friend bool operator>(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) < 0;
+        }
+
+        friend bool operator>=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+        friend bool operator>=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+        friend bool operator>=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) <= 0;
+        }
+
+        friend std::basic_ostream<CharT,CharTraits>& operator<<(std::basic_ostream<CharT,CharTraits>& os, const basic_interned_key& key)
+        {
+            os.write(key.data(), key.size());
+            return os;
+        }
+    private:
+        static const CharT* empty_string() noexcept
+        {
+            static const CharT s[1] = {0};
+            return s;
+        }
+
+        static pointer create(const CharT* s, size_type length, const void* table, const Allocator& alloc)
+        {
+            return length == 0 && table == nullptr ? nullptr : heap_string_factory_type::create(s, length, detail::interned_key_extra(table), alloc);
+        }
+
+        void add_ref() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                ptr_->extra_.refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static void release(pointer ptr) noexcept
+        {
+            if (ptr != nullptr && ptr->extra_.refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                heap_string_factory_type::destroy(ptr);
+            }
+        }
+    };
+
+    template <class CharT, class CharTraits, class Allocator>
+    constexpr typename basic_interned_key<CharT,CharTraits,Allocator>::size_type basic_interned_key<CharT,CharTraits,Allocator>::npos;
+
+    // basic_key_intern_table
+
+    // Makes basic_interned_key keys, one string for each distinct text. The strings are allocated
+    // with the allocator of the table, and live as long as the table or any key that refers to
+    // them. A table may be shared by the decoders of many documents, but not by several threads
+    // at once.
+
+    template <class CharT, class CharTraits = std::char_traits<CharT>, class Allocator = std::allocator<CharT>>
+    class basic_key_intern_table
+    {
+    public:
+        using key_type = basic_interned_key<CharT,CharTraits,Allocator>;
+        using allocator_type = Allocator;
+        using string_view_type = typename key_type::string_view_type;
+    private:
+        using pointer = typename key_type::pointer;
+        using pointer_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<pointer>;
+
+        allocator_type alloc_;
+        // Open addressing table of strings
+        std::vector<pointer,pointer_allocator_type> slots_;
+        std::size_t size_;
+    public:
+        explicit basic_key_intern_table(const Allocator& alloc = Allocator())
+            : alloc_(alloc), slots_(pointer_allocator_type(alloc)), size_(0)
+        {
+        }
+
+        basic_key_intern_table(const basic_key_intern_table&) = delete;
+        basic_key_intern_table& operator=(const basic_key_intern_table&) = delete;
+
+        // Takes the strings of other, which is left empty
+        basic_key_intern_table(basic_key_intern_table&& other) noexcept
+            : alloc_(other.alloc_), slots_(std::move(other.slots_)), size_(other.size_)
+        {
+            other.slots_.clear();
+            other.size_ = 0;
+            adopt_slots();
+        }
+
+        basic_key_intern_table& operator=(basic_key_intern_table&& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                slots_ = std::move(other.slots_);
+                other.slots_.clear();
+                size_ = other.size_;
+                other.size_ = 0;
+                adopt_slots();
+            }
+            return *this;
+        }
+
+        ~basic_key_intern_table() noexcept
+        {
+            clear();
+        }
+
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+        // The number of distinct keys
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        // Returns the key for s, sharing the string of an equal key made before
+        key_type intern(const string_view_type& s)
+        {
+            if ((size_ + 1)*2 > slots_.size())
+            {
+                rehash(slots_.empty() ? 64 : slots_.size()*2);
+            }
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t slot = hash_key(s) & mask;
+            while (slots_[slot] != nullptr)
+            {
+                if (string_view_type(slots_[slot]->data(), slots_[slot]->length()) == s)
+                {
+                    key_type key(slots_[slot]);
+                    key.add_ref();
+                    return key;
+                }
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = key_type::create(s.data(), s.size(), this, alloc_);
+            ++size_;
+            key_type key(slots_[slot]);
+            key.add_ref();
+            return key;
+        }
+
+        key_type make_key(const CharT* s, std::size_t length)
+        {
+            return intern(string_view_type(s, length));
+        }
+
+        // Forgets all keys. Keys made before keep their strings.
+        void clear() noexcept
+        {
+            for (auto& p : slots_)
+            {
+                if (p != nullptr)
+                {
+                    p->extra_.table.store(nullptr, std::memory_order_relaxed);
+                    key_type::release(p);
+                    p = nullptr;
+                }
+            }
+            size_ = 0;
+        }
+    private:
+        static std::size_t hash_key(const string_view_type& s)
+        {
+            return jsoncons::detail::fnv1a(s.data(), s.size());
+        }
+
+        // Marks the strings in slots_ as interned by this table
+        void adopt_slots() noexcept
+        {
+            for (auto p : slots_)
+            {
+                if (p != nullptr)
+                {
+                    p->extra_.table.store(this, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            std::vector<pointer,pointer_allocator_type> old(capacity, nullptr, pointer_allocator_type(alloc_));
+            old.swap(slots_);
+            const std::size_t mask = slots_.size() - 1;
+            for (auto p : old)
+            {
+                if (p != nullptr)
+                {
+                    std::size_t slot = hash_key(string_view_type(p->data(), p->length())) & mask;
+                    while (slots_[slot] != nullptr)
+                    {
+                        slot = (slot + 1) & mask;
+                    }
+                    slots_[slot] = p;
+                }
+            }
+        }
+    };
+
+    using interned_key = basic_interned_key<char>;
+    using winterned_key = basic_interned_key<wchar_t>;
+
+    using key_intern_table = basic_key_intern_table<char>;
+    using wkey_intern_table = basic_key_intern_table<wchar_t>;
+
+namespace detail {
+
+    // Makes the keys of a decoded document when the key type is not interned
+    template <class KeyT>
+    class uninterned_key_table
+    {
+    public:
+        using key_type = KeyT;
+        using allocator_type = typename KeyT::allocator_type;
+    private:
+        allocator_type alloc_;
+    public:
+        explicit uninterned_key_table(const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
+        {
+        }
+
+        template <class CharT>
+        key_type make_key(const CharT* s, std::size_t length)
+        {
+            return key_type(s, length, alloc_);
+        }
+    };
+
+} // namespace detail
+
+    // The table a decoder uses to make keys of type KeyT
+    template <class KeyT>
+    struct key_table_traits
+    {
+        using table_type = detail::uninterned_key_table<KeyT>;
+    };
+
+    template <class CharT, class CharTraits, class Allocator>
+    struct key_table_traits<basic_interned_key<CharT,CharTraits,Allocator>>
+    {
+        using table_type = basic_key_intern_table<CharT,CharTraits,Allocator>;
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -267,6 +267,46 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Skips an array or object by matching brackets in the raw text, without parsing its contents
+    void skip(std::error_code& ec) override
+    {
+        staj_event_type event_type = cursor_visitor_.event().event_type();
+        if (event_type == staj_event_type::begin_array || event_type == staj_event_type::begin_object)
+        {
+            parser_.begin_skip();
+            while (!parser_.skip_some())
+            {
+                if (source_.is_error())
+                {
+                    ec = json_errc::source_error;
+                    return;
+                }
+                if (source_.eof())
+                {
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+                auto s = source_.read_buffer(ec);
+                if (ec) return;
+                if (s.size() > 0)
+                {
+                    parser_.update(s.data(),s.size());
+                }
+            }
+        }
+        read_next(ec);
+    }
+
     void check_done()
     {
         std::error_code ec;
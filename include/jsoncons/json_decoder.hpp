@@ -15,6 +15,7 @@
 #include <utility> // std::move
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/interned_key.hpp>
 
 namespace jsoncons {
 
@@ -34,6 +35,7 @@ public:
     using json_array_allocator = typename array::allocator_type;
     using json_object_allocator = typename object::allocator_type;
     using json_byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+    using key_table_type = typename key_table_traits<key_type>::table_type;
 private:
 
     enum class structure_type {root_t, array_t, object_t};
@@ -63,6 +65,9 @@ private:
     std::vector<index_key_value<Json>,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_;
+    key_table_type own_keys_;
+    key_table_type* keys_; // null when the decoder makes keys with own_keys_
+    bool packed_typed_arrays_;
 
 public:
     json_decoder(const allocator_type& alloc = allocator_type(), 
@@ -73,7 +78,10 @@ public:
           name_(alloc),
           item_stack_(alloc),
           structure_stack_(temp_alloc),
-          is_valid_(false)
+          is_valid_(false),
+          own_keys_(alloc),
+          keys_(nullptr),
+          packed_typed_arrays_(false)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -88,7 +96,30 @@ public:
           name_(),
           item_stack_(),
           structure_stack_(temp_alloc),
-          is_valid_(false)
+          is_valid_(false),
+          own_keys_(),
+          keys_(nullptr),
+          packed_typed_arrays_(false)
+    {
+        item_stack_.reserve(1000);
+        structure_stack_.reserve(100);
+        structure_stack_.emplace_back(structure_type::root_t, 0);
+    }
+
+    // Makes object keys with keys, which may be shared with other decoders
+    json_decoder(key_table_type& keys, 
+        const allocator_type& alloc = allocator_type(), 
+        const temp_allocator_type& temp_alloc = temp_allocator_type())
+        : allocator_(alloc),
+          result_(),
+          index_(0),
+          name_(alloc),
+          item_stack_(alloc),
+          structure_stack_(temp_alloc),
+          is_valid_(false),
+          own_keys_(alloc),
+          keys_(&keys),
+          packed_typed_arrays_(false)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -117,6 +148,18 @@ public:
         return is_valid_;
     }
 
+    // If true, the elements of a typed array event are kept packed in one buffer,
+    // rather than each in its own Json value. Defaults to false.
+    bool packed_typed_arrays() const
+    {
+        return packed_typed_arrays_;
+    }
+
+    void packed_typed_arrays(bool value)
+    {
+        packed_typed_arrays_ = value;
+    }
+
     Json get_result()
     {
         JSONCONS_ASSERT(is_valid_);
@@ -228,7 +271,7 @@ private:
 
     bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        name_ = key_type(name.data(),name.length(),allocator_);
+        name_ = (keys_ != nullptr ? *keys_ : own_keys_).make_key(name.data(),name.length());
         return true;
     }
 
@@ -393,6 +436,133 @@ private:
         }
         return true;
     }
+    bool visit_typed_array(const jsoncons::span<const uint8_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint16_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint32_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint64_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int8_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int16_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int32_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int64_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(half_arg_t, 
+                           const jsoncons::span<const uint16_t>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        if (!packed_typed_arrays_)
+        {
+            return basic_json_visitor<char_type>::visit_typed_array(half_arg, data, tag, context, ec);
+        }
+        switch (structure_stack_.back().type_)
+        {
+            case structure_type::object_t:
+            case structure_type::array_t:
+                item_stack_.emplace_back(std::move(name_), index_++, typed_array_arg, half_arg, data, tag);
+                break;
+            case structure_type::root_t:
+                result_ = Json(typed_array_arg, half_arg, data, tag, allocator_);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const float>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const double>& data, 
+                           semantic_tag tag,
+                           const ser_context& context,
+                           std::error_code& ec) override
+    {
+        return typed_array_value(data, tag, context, ec);
+    }
+
+    // Keeps the elements packed, as they came, if packed_typed_arrays is set. Otherwise
+    // makes a regular array with the element events of basic_json_visitor.
+    template <class T>
+    bool typed_array_value(const jsoncons::span<const T>& data, semantic_tag tag, 
+                           const ser_context& context, std::error_code& ec)
+    {
+        if (!packed_typed_arrays_)
+        {
+            return basic_json_visitor<char_type>::visit_typed_array(data, tag, context, ec);
+        }
+        switch (structure_stack_.back().type_)
+        {
+            case structure_type::object_t:
+            case structure_type::array_t:
+                item_stack_.emplace_back(std::move(name_), index_++, typed_array_arg, data, tag);
+                break;
+            case structure_type::root_t:
+                result_ = Json(typed_array_arg, data, tag, allocator_);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
 };
 
 } // namespace jsoncons
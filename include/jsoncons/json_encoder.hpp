@@ -23,6 +23,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/sink.hpp>
 #include <jsoncons/detail/write_number.hpp>
+#include <jsoncons/detail/simd.hpp>
 
 namespace jsoncons { 
 namespace detail {
@@ -49,6 +50,18 @@ namespace detail {
         const CharT* end = s + length;
         for (const CharT* it = begin; it != end; ++it)
         {
+            // Copy the run of characters that need no escaping in one append
+            const CharT* run_end = jsoncons::detail::find_escape_special(it, end, escape_all_non_ascii, escape_solidus);
+            if (run_end != it)
+            {
+                sink.append(it, run_end - it);
+                count += (run_end - it);
+                it = run_end;
+                if (it == end)
+                {
+                    break;
+                }
+            }
             CharT c = *it;
             switch (c)
             {
@@ -0,0 +1,423 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <algorithm> // std::count
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <map>
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/unicode_traits.hpp>
+
+namespace jsoncons {
+
+    // json_lines_options
+
+    class json_lines_options
+    {
+        std::size_t num_threads_;
+        std::size_t chunk_size_;
+        bool ordered_;
+    public:
+        json_lines_options()
+            : num_threads_(0), chunk_size_(std::size_t(1) << 20), ordered_(true)
+        {
+        }
+
+        // Number of worker threads, 0 for std::thread::hardware_concurrency()
+        std::size_t num_threads() const
+        {
+            return num_threads_;
+        }
+
+        json_lines_options& num_threads(std::size_t value)
+        {
+            num_threads_ = value;
+            return *this;
+        }
+
+        // Characters read per chunk. A chunk is extended to the next newline, so it never splits a line.
+        std::size_t chunk_size() const
+        {
+            return chunk_size_;
+        }
+
+        json_lines_options& chunk_size(std::size_t value)
+        {
+            chunk_size_ = value > 0 ? value : 1;
+            return *this;
+        }
+
+        // Deliver values in input order, or as soon as their chunk is parsed
+        bool ordered() const
+        {
+            return ordered_;
+        }
+
+        json_lines_options& ordered(bool value)
+        {
+            ordered_ = value;
+            return *this;
+        }
+    };
+
+    // json_lines_reader
+
+    // Reads newline delimited JSON (JSON Lines, NDJSON). The calling thread reads the source in
+    // newline-aligned chunks and hands them to a pool of workers, each with its own parser and decoder.
+    // Values and per-line errors are delivered on the calling thread. Blank lines are skipped.
+
+    template <class Json,class Source=jsoncons::stream_source<typename Json::char_type>>
+    class json_lines_reader
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using source_type = Source;
+    private:
+        struct line_result
+        {
+            std::size_t line;
+            std::size_t column;
+            std::error_code ec;
+            Json value;
+        };
+
+        struct chunk
+        {
+            std::size_t index;
+            std::size_t first_line;
+            std::basic_string<char_type> text;
+            std::vector<line_result> results;
+            std::exception_ptr exception;
+        };
+
+        source_type source_;
+        basic_json_decode_options<char_type> options_;
+        json_lines_options lines_options_;
+        std::basic_string<char_type> carry_;
+        std::size_t line_count_;
+        std::size_t chunk_count_;
+        bool bof_;
+
+        std::mutex mutex_;
+        std::condition_variable work_available_;
+        std::condition_variable work_done_;
+        std::deque<std::unique_ptr<chunk>> pending_;
+        std::map<std::size_t,std::unique_ptr<chunk>> completed_;
+        bool stop_;
+
+        // Noncopyable and nonmoveable
+        json_lines_reader(const json_lines_reader&) = delete;
+        json_lines_reader& operator=(const json_lines_reader&) = delete;
+
+        class worker_pool
+        {
+            json_lines_reader* reader_;
+            std::vector<std::thread> threads_;
+        public:
+            worker_pool(json_lines_reader* reader, std::size_t num_threads)
+                : reader_(reader)
+            {
+                reader_->stop_ = false;
+                JSONCONS_TRY
+                {
+                    threads_.reserve(num_threads);
+                    for (std::size_t i = 0; i < num_threads; ++i)
+                    {
+                        threads_.emplace_back(&json_lines_reader::run_worker, reader_);
+                    }
+                }
+                JSONCONS_CATCH(...)
+                {
+                    // The destructor won't run, so stop the threads that did start
+                    stop_and_join();
+                    JSONCONS_RETHROW;
+                }
+            }
+
+            ~worker_pool() noexcept
+            {
+                stop_and_join();
+            }
+        private:
+            // Also drops any chunks left behind by an exception out of read, so that the
+            // reader can be used again
+            void stop_and_join() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock(reader_->mutex_);
+                    reader_->stop_ = true;
+                }
+                reader_->work_available_.notify_all();
+                for (auto& t : threads_)
+                {
+                    t.join();
+                }
+                threads_.clear();
+                reader_->pending_.clear();
+                reader_->completed_.clear();
+            }
+        };
+    public:
+        template <class Sourceable>
+        explicit json_lines_reader(Sourceable&& source,
+                                   const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                   const json_lines_options& lines_options = json_lines_options())
+            : source_(std::forward<Sourceable>(source)),
+              options_(options),
+              lines_options_(lines_options),
+              line_count_(0),
+              chunk_count_(0),
+              bof_(true),
+              stop_(false)
+        {
+        }
+
+        // Calls on_value(line, value) for each value. Throws ser_error on the first line that fails to parse.
+        template <class F>
+        void read(F on_value)
+        {
+            read(on_value, [](const ser_error& e){JSONCONS_THROW(e);});
+        }
+
+        // Calls on_value(line, value) for each value and on_error(const ser_error&) for each line that
+        // fails to parse. The line and column of the error are those of the input.
+        template <class F,class E>
+        void read(F on_value, E on_error)
+        {
+            std::size_t num_threads = lines_options_.num_threads();
+            if (num_threads == 0)
+            {
+                num_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+            }
+            const std::size_t max_in_flight = 2*num_threads;
+            const bool ordered = lines_options_.ordered();
+
+            worker_pool pool(this, num_threads);
+
+            std::size_t in_flight = 0;
+            std::size_t next_to_deliver = chunk_count_;
+            bool exhausted = false;
+            while (true)
+            {
+                while (!exhausted && in_flight < max_in_flight)
+                {
+                    std::unique_ptr<chunk> c = read_chunk();
+                    if (!c)
+                    {
+                        exhausted = true;
+                        break;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        pending_.push_back(std::move(c));
+                    }
+                    work_available_.notify_one();
+                    ++in_flight;
+                }
+                if (in_flight == 0)
+                {
+                    break;
+                }
+
+                std::unique_ptr<chunk> c;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    work_done_.wait(lock, [&]() -> bool {return ordered ? completed_.count(next_to_deliver) != 0 : !completed_.empty();});
+                    auto it = ordered ? completed_.find(next_to_deliver) : completed_.begin();
+                    c = std::move(it->second);
+                    completed_.erase(it);
+                }
+                --in_flight;
+                ++next_to_deliver;
+
+                if (c->exception)
+                {
+                    std::rethrow_exception(c->exception);
+                }
+                for (auto& result : c->results)
+                {
+                    if (result.ec)
+                    {
+                        on_error(ser_error(result.ec, result.line, result.column));
+                    }
+                    else
+                    {
+                        on_value(result.line, std::move(result.value));
+                    }
+                }
+            }
+
+            if (source_.is_error())
+            {
+                on_error(ser_error(json_errc::source_error, line_count_ + 1, 1));
+            }
+        }
+
+    private:
+        std::unique_ptr<chunk> read_chunk()
+        {
+            std::basic_string<char_type> text = std::move(carry_);
+            carry_.clear();
+
+            const std::size_t chunk_size = lines_options_.chunk_size();
+            std::size_t offset = text.size();
+            while (true)
+            {
+                text.resize(offset + chunk_size);
+                std::size_t n = source_.is_error() ? 0 : source_.read(&text[offset], chunk_size);
+                text.resize(offset + n);
+                if (bof_ && !text.empty())
+                {
+                    auto r = unicode_traits::detect_encoding_from_bom(text.data(), text.size());
+                    text.erase(0, r.ptr - text.data());
+                    offset = 0;
+                    bof_ = false;
+                    if (text.empty())
+                    {
+                        continue;
+                    }
+                }
+                if (n == 0)
+                {
+                    break;
+                }
+                auto pos = text.find_last_of(char_type('\n'));
+                if (pos != std::basic_string<char_type>::npos && pos >= offset)
+                {
+                    carry_.assign(text, pos + 1, std::basic_string<char_type>::npos);
+                    text.resize(pos + 1);
+                    break;
+                }
+                offset = text.size();
+            }
+            if (text.empty())
+            {
+                return std::unique_ptr<chunk>();
+            }
+
+            std::unique_ptr<chunk> c(new chunk());
+            c->index = chunk_count_++;
+            c->first_line = line_count_ + 1;
+            line_count_ += std::count(text.begin(), text.end(), char_type('\n'));
+            c->text = std::move(text);
+            return c;
+        }
+
+        void run_worker()
+        {
+            basic_json_parser<char_type> parser(options_);
+            json_decoder<Json> decoder;
+
+            while (true)
+            {
+                std::unique_ptr<chunk> c;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    work_available_.wait(lock, [this]() -> bool {return stop_ || !pending_.empty();});
+                    if (stop_)
+                    {
+                        return;
+                    }
+                    c = std::move(pending_.front());
+                    pending_.pop_front();
+                }
+
+                JSONCONS_TRY
+                {
+                    parse_chunk(*c, parser, decoder);
+                }
+                JSONCONS_CATCH(...)
+                {
+                    c->exception = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    std::size_t index = c->index;
+                    completed_.emplace(index, std::move(c));
+                }
+                work_done_.notify_one();
+            }
+        }
+
+        static void parse_chunk(chunk& c, basic_json_parser<char_type>& parser, json_decoder<Json>& decoder)
+        {
+            const char_type* p = c.text.data();
+            const char_type* end = p + c.text.size();
+            std::size_t line = c.first_line;
+
+            for (; p < end; ++line)
+            {
+                const char_type* line_end = std::find(p, end, char_type('\n'));
+                const char_type* next = line_end == end ? end : line_end + 1;
+                if (line_end != p && *(line_end - 1) == '\r')
+                {
+                    --line_end;
+                }
+                if (!is_blank(p, line_end))
+                {
+                    std::error_code ec;
+                    parser.reinitialize();
+                    parser.update(p, line_end - p);
+                    parser.parse_some(decoder, ec);
+                    if (!ec)
+                    {
+                        parser.finish_parse(decoder, ec);
+                    }
+                    if (!ec)
+                    {
+                        parser.check_done(ec);
+                    }
+                    if (!ec && decoder.is_valid())
+                    {
+                        c.results.push_back(line_result{line, 0, std::error_code(), decoder.get_result()});
+                    }
+                    else
+                    {
+                        c.results.push_back(line_result{line, parser.column(), ec ? ec : json_errc::source_error, Json()});
+                        decoder.reset();
+                    }
+                }
+                p = next;
+            }
+            c.text.clear();
+            c.text.shrink_to_fit();
+        }
+
+        static bool is_blank(const char_type* first, const char_type* last)
+        {
+            for (; first != last; ++first)
+            {
+                if (!(*first == ' ' || *first == '\t' || *first == '\r'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -17,12 +17,14 @@
 #include <initializer_list>
 #include <iterator> // std::iterator_traits
 #include <memory> // std::allocator
+#include <cstdint>
 #include <utility> // std::move
 #include <cassert> // assert
 #include <unordered_set>
 #include <type_traits> // std::enable_if
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/detail/fnv1a.hpp>
 #include <jsoncons/json_array.hpp>
 
 namespace jsoncons {
@@ -317,6 +319,7 @@ namespace jsoncons {
         using key_value_type = key_value<KeyT,Json>;
         using char_type = typename Json::char_type;
         using string_view_type = typename Json::string_view_type;
+        using key_order_type = sort_key_order;
     private:
         struct Comp
         {
@@ -324,10 +327,38 @@ namespace jsoncons {
             bool operator() (string_view_type k, const key_value_type& kv) const { return k < kv.key(); }
         };
 
+        // The leading characters of a key, packed so that comparing two prefixes as integers
+        // orders them as their keys, with a hash and the length of the whole key
+        struct key_prefix
+        {
+            uint64_t prefix;
+            uint32_t hash;
+            uint32_t length;
+        };
+
+        struct PrefixComp
+        {
+            bool operator() (const key_prefix& a, uint64_t b) const { return a.prefix < b; }
+            bool operator() (uint64_t a, const key_prefix& b) const { return a < b.prefix; }
+        };
+
+        // Objects with at least this many members keep a prefix index of their keys
+        static constexpr std::size_t index_threshold = 16;
+        // Wider characters compare as char_traits orders them, which may not be unsigned,
+        // so only keys of narrow characters are packed into prefixes and indexed
+        static constexpr bool is_indexed = sizeof(char_type) == 1;
+        // Members with equal prefixes that are searched linearly rather than by bisection
+        static constexpr std::size_t linear_search_limit = 8;
+
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
         using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
+        using prefix_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_prefix>;
+        using prefix_container_type = std::vector<key_prefix,prefix_allocator_type>;
 
         key_value_container_type members_;
+        // The prefixes of the member keys, in member order, so that most probes of a search
+        // do not touch key strings. Left empty while the object has fewer than index_threshold members.
+        prefix_container_type prefixes_;
     public:
         using iterator = typename key_value_container_type::iterator;
         using const_iterator = typename key_value_container_type::const_iterator;
@@ -340,30 +371,35 @@ namespace jsoncons {
 
         explicit sorted_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              prefixes_(prefix_allocator_type(alloc))
         {
         }
 
         sorted_json_object(const sorted_json_object& other)
             : allocator_holder<allocator_type>(other.get_allocator()),
-              members_(other.members_)
+              members_(other.members_),
+              prefixes_(other.prefixes_)
         {
         }
 
         sorted_json_object(const sorted_json_object& other, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(other.members_,key_value_allocator_type(alloc))
+              members_(other.members_,key_value_allocator_type(alloc)),
+              prefixes_(other.prefixes_,prefix_allocator_type(alloc))
         {
         }
 
         sorted_json_object(sorted_json_object&& other) noexcept
-            : allocator_holder<allocator_type>(other.get_allocator()), 
-              members_(std::move(other.members_))
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              members_(std::move(other.members_)),
+              prefixes_(std::move(other.prefixes_))
         {
         }
 
         sorted_json_object(sorted_json_object&& other,const allocator_type& alloc) 
-            : allocator_holder<allocator_type>(alloc), members_(std::move(other.members_),key_value_allocator_type(alloc))
+            : allocator_holder<allocator_type>(alloc), members_(std::move(other.members_),key_value_allocator_type(alloc)),
+              prefixes_(std::move(other.prefixes_),prefix_allocator_type(alloc))
         {
         }
 
@@ -371,6 +407,7 @@ namespace jsoncons {
         {
             allocator_holder<allocator_type>::operator=(other.get_allocator());
             members_ = other.members_;
+            prefixes_ = other.prefixes_;
             return *this;
         }
 
@@ -394,13 +431,15 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            reindex();
         }
 
         template<class InputIt>
         sorted_json_object(InputIt first, InputIt last, 
                     const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              prefixes_(prefix_allocator_type(alloc))
         {
             std::size_t count = std::distance(first,last);
             members_.reserve(count);
@@ -413,12 +452,14 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            reindex();
         }
 
         sorted_json_object(const std::initializer_list<std::pair<std::basic_string<char_type>,Json>>& init, 
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              prefixes_(prefix_allocator_type(alloc))
         {
             members_.reserve(init.size());
             for (auto& item : init)
@@ -440,6 +481,7 @@ namespace jsoncons {
         void swap(sorted_json_object& other) noexcept
         {
             members_.swap(other.members_);
+            prefixes_.swap(other.prefixes_);
         }
 
         iterator begin()
@@ -466,7 +508,11 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
-        void clear() {members_.clear();}
+        void clear()
+        {
+            members_.clear();
+            prefixes_.clear();
+        }
 
         void shrink_to_fit() 
         {
@@ -475,6 +521,7 @@ namespace jsoncons {
                 members_[i].shrink_to_fit();
             }
             members_.shrink_to_fit();
+            prefixes_.shrink_to_fit();
         }
 
         void reserve(std::size_t n) {members_.reserve(n);}
@@ -499,45 +546,49 @@ namespace jsoncons {
 
         iterator find(const string_view_type& name) noexcept
         {
-            auto p = std::equal_range(members_.begin(),members_.end(), name, 
-                                       Comp());        
-            return p.first == p.second ? members_.end() : p.first;
+            return members_.begin() + find_pos(name);
         }
 
         const_iterator find(const string_view_type& name) const noexcept
         {
-            auto p = std::equal_range(members_.begin(),members_.end(), name, 
-                                       Comp());        
-            return p.first == p.second ? members_.end() : p.first;
+            return members_.begin() + find_pos(name);
         }
 
         iterator erase(const_iterator pos) 
         {
+            std::size_t pos1 = pos - members_.begin();
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
             iterator it = members_.begin() + (pos - members_.begin());
-            return members_.erase(it);
+            it = members_.erase(it);
     #else
-            return members_.erase(pos);
+            iterator it = members_.erase(pos);
     #endif
+            unindex_members(pos1, pos1 + 1);
+            return it;
         }
 
         iterator erase(const_iterator first, const_iterator last) 
         {
+            std::size_t pos1 = first - members_.begin();
+            std::size_t pos2 = last - members_.begin();
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
             iterator it1 = members_.begin() + (first - members_.begin());
             iterator it2 = members_.begin() + (last - members_.begin());
-            return members_.erase(it1,it2);
+            iterator it = members_.erase(it1,it2);
     #else
-            return members_.erase(first,last);
+            iterator it = members_.erase(first,last);
     #endif
+            unindex_members(pos1, pos2);
+            return it;
         }
 
         void erase(const string_view_type& name) 
         {
-            auto it = find(name);
-            if (it != members_.end())
+            std::size_t pos = find_pos(name);
+            if (pos != members_.size())
             {
-                members_.erase(it);
+                members_.erase(members_.begin() + pos);
+                unindex_members(pos, pos + 1);
             }
         }
 
@@ -556,7 +607,6 @@ namespace jsoncons {
             if (count > 0)
             {
                 members_.reserve(count);
-
                 auto last = first + count;
 
                 std::sort(first, last, compare);
@@ -570,6 +620,7 @@ namespace jsoncons {
                     }
                     ++prev_it;
                 }
+                reindex();
             }
         }
 
@@ -585,6 +636,7 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            reindex();
         }
 
         template<class InputIt>
@@ -607,9 +659,40 @@ namespace jsoncons {
                         members_.emplace_back(convert(*s));
                     }
                 }
+                reindex();
             }
         }
 
+        // Inserts or assigns the members of a range of key-value pairs in one pass. Where keys in the
+        // range are equal, the last one wins.
+        template<class InputIt,class=typename std::enable_if<!std::is_convertible<InputIt,string_view_type>::value,typename std::iterator_traits<InputIt>::iterator_category>::type>
+        void insert_or_assign(InputIt first, InputIt last)
+        {
+            key_value_allocator_type alloc(get_allocator());
+            key_value_container_type items(alloc);
+            for (auto s = first; s != last; ++s)
+            {
+                items.emplace_back(get_key_value<KeyT,Json>()(*s));
+            }
+            std::stable_sort(items.begin(),items.end(),
+                             [](const key_value_type& a, const key_value_type& b) -> bool {return a.key().compare(b.key()) < 0;});
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                if (i + 1 < items.size() && items[i].key() == items[i+1].key())
+                {
+                    continue;
+                }
+                if (count != i)
+                {
+                    items[count] = std::move(items[i]);
+                }
+                ++count;
+            }
+            items.erase(items.begin() + count, items.end());
+            merge_sorted(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()), true);
+        }
+
         // insert_or_assign
 
         template <class T, class A=allocator_type>
@@ -617,12 +700,13 @@ namespace jsoncons {
         insert_or_assign(const string_view_type& name, T&& value)
         {
             bool inserted;
-            auto it = std::lower_bound(members_.begin(),members_.end(), name, Comp());        
+            auto it = members_.begin() + lower_bound_pos(0, name);
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), std::forward<T>(value));
                 inserted = true;
                 it = members_.begin() + members_.size() - 1;
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -632,6 +716,7 @@ namespace jsoncons {
             else
             {
                 it = members_.emplace(it, key_type(name.begin(),name.end()), std::forward<T>(value));
+                it = index_member(it);
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -642,13 +727,13 @@ namespace jsoncons {
         insert_or_assign(const string_view_type& name, T&& value)
         {
             bool inserted;
-            auto it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                       Comp());        
+            auto it = members_.begin() + lower_bound_pos(0, name);
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), std::forward<T>(value));
                 inserted = true;
                 it = members_.begin() + members_.size() - 1;
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -659,6 +744,7 @@ namespace jsoncons {
             {
                 it = members_.emplace(it, key_type(name.begin(),name.end(), get_allocator()),
                     std::forward<T>(value));
+                it = index_member(it);
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -671,12 +757,12 @@ namespace jsoncons {
         try_emplace(const string_view_type& name, Args&&... args)
         {
             bool inserted;
-            auto it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                       Comp());        
+            auto it = members_.begin() + lower_bound_pos(0, name);
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), std::forward<Args>(args)...);
                 it = members_.begin() + members_.size() - 1;
+                it = index_member(it);
                 inserted = true;
             }
             else if (it->key() == name)
@@ -687,6 +773,7 @@ namespace jsoncons {
             {
                 it = members_.emplace(it, key_type(name.begin(),name.end()),
                                             std::forward<Args>(args)...);
+                it = index_member(it);
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -697,12 +784,12 @@ namespace jsoncons {
         try_emplace(const string_view_type& name, Args&&... args)
         {
             bool inserted;
-            auto it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                       Comp());        
+            auto it = members_.begin() + lower_bound_pos(0, name);
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), std::forward<Args>(args)...);
                 it = members_.begin() + members_.size() - 1;
+                it = index_member(it);
                 inserted = true;
             }
             else if (it->key() == name)
@@ -714,6 +801,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<Args>(args)...);
+                it = index_member(it);
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -723,24 +811,14 @@ namespace jsoncons {
         typename std::enable_if<extension_traits::is_stateless<A>::value,iterator>::type 
         try_emplace(iterator hint, const string_view_type& name, Args&&... args)
         {
-            iterator it = hint;
-
-            if (hint != members_.end() && hint->key() <= name)
-            {
-                it = std::lower_bound(hint,members_.end(), name, 
-                                      Comp());        
-            }
-            else
-            {
-                it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                      Comp());        
-            }
+            iterator it = members_.begin() + lower_bound_pos(hint_pos(hint, name), name);
 
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), 
                     std::forward<Args>(args)...);
                 it = members_.begin() + (members_.size() - 1);
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -750,6 +828,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end()),
                                             std::forward<Args>(args)...);
+                it = index_member(it);
             }
 
             return it;
@@ -759,23 +838,14 @@ namespace jsoncons {
         typename std::enable_if<!extension_traits::is_stateless<A>::value,iterator>::type 
         try_emplace(iterator hint, const string_view_type& name, Args&&... args)
         {
-            iterator it = hint;
-            if (hint != members_.end() && hint->key() <= name)
-            {
-                it = std::lower_bound(hint,members_.end(), name, 
-                                      Comp());        
-            }
-            else
-            {
-                it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                      Comp());        
-            }
+            iterator it = members_.begin() + lower_bound_pos(hint_pos(hint, name), name);
 
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), 
                     std::forward<Args>(args)...);
                 it = members_.begin() + (members_.size() - 1);
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -785,6 +855,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<Args>(args)...);
+                it = index_member(it);
             }
             return it;
         }
@@ -795,22 +866,13 @@ namespace jsoncons {
         typename std::enable_if<extension_traits::is_stateless<A>::value,iterator>::type 
         insert_or_assign(iterator hint, const string_view_type& name, T&& value)
         {
-            iterator it;
-            if (hint != members_.end() && hint->key() <= name)
-            {
-                it = std::lower_bound(hint,members_.end(), name, 
-                                      [](const key_value_type& a, const string_view_type& k) -> bool {return string_view_type(a.key()).compare(k) < 0;});        
-            }
-            else
-            {
-                it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                      [](const key_value_type& a, const string_view_type& k) -> bool {return string_view_type(a.key()).compare(k) < 0;});        
-            }
+            iterator it = members_.begin() + lower_bound_pos(hint_pos(hint, name), name);
 
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), std::forward<T>(value));
                 it = members_.begin() + (members_.size() - 1);
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -819,6 +881,7 @@ namespace jsoncons {
             else
             {
                 it = members_.emplace(it, key_type(name.begin(),name.end()), std::forward<T>(value));
+                it = index_member(it);
             }
             return it;
         }
@@ -827,22 +890,13 @@ namespace jsoncons {
         typename std::enable_if<!extension_traits::is_stateless<A>::value,iterator>::type 
         insert_or_assign(iterator hint, const string_view_type& name, T&& value)
         {
-            iterator it;
-            if (hint != members_.end() && hint->key() <= name)
-            {
-                it = std::lower_bound(hint,members_.end(), name, 
-                                      Comp());        
-            }
-            else
-            {
-                it = std::lower_bound(members_.begin(),members_.end(), name, 
-                                      Comp());        
-            }
+            iterator it = members_.begin() + lower_bound_pos(hint_pos(hint, name), name);
 
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), std::forward<T>(value));
                 it = members_.begin() + (members_.size() - 1);
+                it = index_member(it);
             }
             else if (it->key() == name)
             {
@@ -852,6 +906,7 @@ namespace jsoncons {
             {
                 it = members_.emplace(it, key_type(name.begin(),name.end(), get_allocator()),
                     std::forward<T>(value));
+                it = index_member(it);
             }
             return it;
         }
@@ -860,29 +915,12 @@ namespace jsoncons {
 
         void merge(const sorted_json_object& source)
         {
-            for (auto it = source.begin(); it != source.end(); ++it)
-            {
-                try_emplace(it->key(),it->value());
-            }
+            merge_sorted(source.begin(), source.end(), false);
         }
 
         void merge(sorted_json_object&& source)
         {
-            auto it = std::make_move_iterator(source.begin());
-            auto end = std::make_move_iterator(source.end());
-            for (; it != end; ++it)
-            {
-                auto pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                            Comp());   
-                if (pos == members_.end() )
-                {
-                    members_.emplace_back(*it);
-                }
-                else if ((*it).key() != pos->key())
-                {
-                    members_.emplace(pos,*it);
-                }
-            }
+            merge_sorted(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()), false);
         }
 
         void merge(iterator hint, const sorted_json_object& source)
@@ -899,25 +937,17 @@ namespace jsoncons {
             auto end = std::make_move_iterator(source.end());
             for (; it != end; ++it)
             {
-                iterator pos;
-                if (hint != members_.end() && hint->key() <= (*it).key())
-                {
-                    pos = std::lower_bound(hint,members_.end(), (*it).key(), 
-                                          Comp());        
-                }
-                else
-                {
-                    pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                          Comp());        
-                }
+                iterator pos = members_.begin() + lower_bound_pos(hint_pos(hint, (*it).key()), (*it).key());
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
                     hint = members_.begin() + (members_.size() - 1);
+                    hint = index_member(hint);
                 }
                 else if ((*it).key() != pos->key())
                 {
                     hint = members_.emplace(pos,*it);
+                    hint = index_member(hint);
                 }
             }
         }
@@ -926,29 +956,12 @@ namespace jsoncons {
 
         void merge_or_update(const sorted_json_object& source)
         {
-            for (auto it = source.begin(); it != source.end(); ++it)
-            {
-                insert_or_assign((*it).key(),(*it).value());
-            }
+            merge_sorted(source.begin(), source.end(), true);
         }
 
         void merge_or_update(sorted_json_object&& source)
         {
-            auto it = std::make_move_iterator(source.begin());
-            auto end = std::make_move_iterator(source.end());
-            for (; it != end; ++it)
-            {
-                auto pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                            Comp());   
-                if (pos == members_.end() )
-                {
-                    members_.emplace_back(*it);
-                }
-                else 
-                {
-                    pos->value((*it).value());
-                }
-            }
+            merge_sorted(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()), true);
         }
 
         void merge_or_update(iterator hint, const sorted_json_object& source)
@@ -965,23 +978,19 @@ namespace jsoncons {
             auto end = std::make_move_iterator(source.end());
             for (; it != end; ++it)
             {
-                iterator pos;
-                if (hint != members_.end() && hint->key() <= (*it).key())
-                {
-                    pos = std::lower_bound(hint,members_.end(), (*it).key(), 
-                                          Comp());        
-                }
-                else
-                {
-                    pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                          Comp());        
-                }
+                iterator pos = members_.begin() + lower_bound_pos(hint_pos(hint, (*it).key()), (*it).key());
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
                     hint = members_.begin() + (members_.size() - 1);
+                    hint = index_member(hint);
+                }
+                else if ((*it).key() != pos->key())
+                {
+                    hint = members_.emplace(pos,*it);
+                    hint = index_member(hint);
                 }
-                else 
+                else
                 {
                     pos->value((*it).value());
                     hint = pos;
@@ -1000,6 +1009,203 @@ namespace jsoncons {
         }
     private:
 
+        // Merges a sorted range with unique keys. Keys already present are assigned if assign is true,
+        // and kept otherwise. A range of more than one member is merged in one pass rather than
+        // by inserting members one at a time.
+        template <class Iterator>
+        void merge_sorted(Iterator first, Iterator last, bool assign)
+        {
+            std::size_t count = 0;
+            std::size_t pos = 0;
+            for (auto it = first; it != last; ++it)
+            {
+                pos = lower_bound_pos(pos, (*it).key());
+                if (pos < members_.size() && members_[pos].key() == (*it).key())
+                {
+                    if (assign)
+                    {
+                        members_[pos].value((*it).value());
+                    }
+                }
+                else
+                {
+                    ++count;
+                }
+            }
+            if (count == 0)
+            {
+                return;
+            }
+            if (count == 1)
+            {
+                for (auto it = first; it != last; ++it)
+                {
+                    auto p = members_.begin() + lower_bound_pos(0, (*it).key());
+                    if (p == members_.end() || p->key() != (*it).key())
+                    {
+                        index_member(members_.emplace(p, *it));
+                        break;
+                    }
+                }
+                return;
+            }
+
+            key_value_allocator_type alloc(get_allocator());
+            key_value_container_type merged(alloc);
+            merged.reserve(members_.size() + count);
+            auto p = members_.begin();
+            for (auto it = first; it != last; ++it)
+            {
+                while (p != members_.end() && p->key() < (*it).key())
+                {
+                    merged.emplace_back(std::move(*p));
+                    ++p;
+                }
+                if (p != members_.end() && p->key() == (*it).key())
+                {
+                    merged.emplace_back(std::move(*p));
+                    ++p;
+                }
+                else
+                {
+                    merged.emplace_back(*it);
+                }
+            }
+            for (; p != members_.end(); ++p)
+            {
+                merged.emplace_back(std::move(*p));
+            }
+            members_.swap(merged);
+            reindex();
+        }
+
+        // The position to start a search for name from hint
+        std::size_t hint_pos(iterator hint, const string_view_type& name) const
+        {
+            return hint != members_.end() && hint->key() <= name ? hint - members_.begin() : 0;
+        }
+
+        std::size_t lower_bound_pos(std::size_t first, const string_view_type& name) const
+        {
+            std::size_t last = members_.size();
+            if (!prefixes_.empty())
+            {
+                const uint64_t prefix = make_prefix(name).prefix;
+                auto p = std::equal_range(prefixes_.begin() + first, prefixes_.end(), prefix, PrefixComp());
+                first = p.first - prefixes_.begin();
+                last = p.second - prefixes_.begin();
+            }
+            return std::lower_bound(members_.begin() + first, members_.begin() + last, name, Comp()) - members_.begin();
+        }
+
+        std::size_t find_pos(const string_view_type& name) const noexcept
+        {
+            if (prefixes_.empty())
+            {
+                auto p = std::equal_range(members_.begin(),members_.end(), name, Comp());
+                return p.first == p.second ? members_.size() : p.first - members_.begin();
+            }
+            const key_prefix key = make_prefix(name);
+            auto p = std::equal_range(prefixes_.begin(), prefixes_.end(), key.prefix, PrefixComp());
+            if (static_cast<std::size_t>(p.second - p.first) <= linear_search_limit)
+            {
+                for (auto q = p.first; q != p.second; ++q)
+                {
+                    if (q->length == key.length && q->hash == key.hash)
+                    {
+                        const std::size_t pos = q - prefixes_.begin();
+                        if (members_[pos].key() == name)
+                        {
+                            return pos;
+                        }
+                    }
+                }
+                return members_.size();
+            }
+            auto first = members_.begin() + (p.first - prefixes_.begin());
+            auto last = members_.begin() + (p.second - prefixes_.begin());
+            auto it = std::lower_bound(first, last, name, Comp());
+            return it != last && it->key() == name ? it - members_.begin() : members_.size();
+        }
+
+        static key_prefix make_prefix(const string_view_type& s) noexcept
+        {
+            key_prefix key;
+            key.prefix = 0;
+            const std::size_t n = s.size() < sizeof(uint64_t) ? s.size() : sizeof(uint64_t);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                key.prefix |= static_cast<uint64_t>(static_cast<uint8_t>(s[i])) << (8*(sizeof(uint64_t) - 1 - i));
+            }
+            key.hash = jsoncons::detail::fnv1a_32(s.data(), s.size());
+            key.length = static_cast<uint32_t>(s.size());
+            return key;
+        }
+
+        // Indexes the member just inserted at it
+        iterator index_member(iterator it) noexcept
+        {
+            if (!is_indexed)
+            {
+                return it;
+            }
+            if (prefixes_.empty() ? members_.size() >= index_threshold : prefixes_.size() == prefixes_.capacity())
+            {
+                // Room to grow, so that inserting one member at a time reindexes O(log n) times
+                reindex(2*members_.size());
+            }
+            else if (!prefixes_.empty())
+            {
+                // Capacity is available, so this does not throw
+                prefixes_.insert(prefixes_.begin() + (it - members_.begin()), make_prefix(it->key()));
+            }
+            return it;
+        }
+
+        // Removes the prefixes of members erased from [pos1, pos2)
+        void unindex_members(std::size_t pos1, std::size_t pos2)
+        {
+            if (members_.size() < index_threshold)
+            {
+                prefixes_.clear();
+            }
+            else if (!prefixes_.empty())
+            {
+                prefixes_.erase(prefixes_.begin() + pos1, prefixes_.begin() + pos2);
+            }
+        }
+
+        void reindex() noexcept
+        {
+            reindex(members_.size());
+        }
+
+        // Builds new prefixes for the members. Members are inserted before they are indexed, so
+        // should allocating the prefixes fail, the index is dropped rather than the exception let
+        // out, and lookups fall back to a binary search of the members until the next reindex.
+        void reindex(std::size_t capacity) noexcept
+        {
+            prefixes_.clear();
+            if (!is_indexed || members_.size() < index_threshold)
+            {
+                return;
+            }
+            JSONCONS_TRY
+            {
+                prefix_container_type prefixes(prefixes_.get_allocator());
+                prefixes.reserve(capacity);
+                for (const auto& kv : members_)
+                {
+                    prefixes.push_back(make_prefix(kv.key()));
+                }
+                prefixes_.swap(prefixes);
+            }
+            JSONCONS_CATCH(...)
+            {
+                prefixes_.clear();
+            }
+        }
+
         void flatten_and_destroy() noexcept
         {
             if (!members_.empty())
@@ -1025,6 +1231,14 @@ namespace jsoncons {
         }
     };
 
+    template <class KeyT,class Json,template<typename,typename> class SequenceContainer>
+    constexpr std::size_t sorted_json_object<KeyT,Json,SequenceContainer>::index_threshold;
+    template <class KeyT,class Json,template<typename,typename> class SequenceContainer>
+    constexpr bool sorted_json_object<KeyT,Json,SequenceContainer>::is_indexed;
+
+    template <class KeyT,class Json,template<typename,typename> class SequenceContainer>
+    constexpr std::size_t sorted_json_object<KeyT,Json,SequenceContainer>::linear_search_limit;
+
     // Preserve order
     template <class KeyT,class Json,template<typename,typename> class SequenceContainer = std::vector>
     class order_preserving_json_object : public allocator_holder<typename Json::allocator_type>
@@ -1035,27 +1249,34 @@ namespace jsoncons {
         using key_type = KeyT;
         using string_view_type = typename Json::string_view_type;
         using key_value_type = key_value<KeyT,Json>;
+        using key_order_type = preserve_key_order;
     private:
+        static std::size_t hash_key(const char_type* s, std::size_t length) noexcept
+        {
+            return jsoncons::detail::fnv1a(s, length);
+        }
+
         struct MyHash
         {
-            std::uintmax_t operator()(const key_type& s) const noexcept
+            std::size_t operator()(const key_type& s) const noexcept
             {
-                const int p = 31;
-                const int m = static_cast<int>(1e9) + 9;
-                std::uintmax_t hash_value = 0;
-                std::uintmax_t p_pow = 1;
-                for (char_type c : s) {
-                    hash_value = (hash_value + (c - 'a' + 1) * p_pow) % m;
-                    p_pow = (p_pow * p) % m;
-                }
-                return hash_value;   
+                return hash_key(s.data(), s.size());
             }
         };
 
+        // Objects with at least this many members keep a hash index of their keys
+        static constexpr std::size_t index_threshold = 16;
+
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
         using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
+        using index_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::size_t>;
+        using index_container_type = std::vector<std::size_t,index_allocator_type>;
 
         key_value_container_type members_;
+        // Open addressing table of member positions plus one (zero marks an empty slot),
+        // left empty while the object has fewer than index_threshold members. Every object
+        // carries the empty vector, a table has two to four slots per member.
+        index_container_type index_;
 
         struct Comp
         {
@@ -1080,31 +1301,36 @@ namespace jsoncons {
         }
         order_preserving_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              members_(val.members_)
+              members_(val.members_),
+              index_(val.index_)
         {
         }
 
         order_preserving_json_object(order_preserving_json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(std::move(val.members_),key_value_allocator_type(alloc))
+              members_(std::move(val.members_),key_value_allocator_type(alloc)),
+              index_(std::move(val.index_),index_allocator_type(alloc))
         {
         }
 
         order_preserving_json_object(order_preserving_json_object&& val) noexcept
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              members_(std::move(val.members_))
+              members_(std::move(val.members_)),
+              index_(std::move(val.index_))
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(val.members_,key_value_allocator_type(alloc))
+              members_(val.members_,key_value_allocator_type(alloc)),
+              index_(val.index_,index_allocator_type(alloc))
         {
         }
 
@@ -1119,6 +1345,7 @@ namespace jsoncons {
                 {
                     keys.emplace(kv.key());
                     members_.emplace_back(std::move(kv));
+                    index_member(members_.size()-1);
                 }
             }
         }
@@ -1127,7 +1354,8 @@ namespace jsoncons {
         order_preserving_json_object(InputIt first, InputIt last, 
                     const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
             std::unordered_set<key_type,MyHash> keys;
             for (auto it = first; it != last; ++it)
@@ -1137,6 +1365,7 @@ namespace jsoncons {
                 {
                     keys.emplace(kv.key());
                     members_.emplace_back(std::move(kv));
+                    index_member(members_.size()-1);
                 }
             }
         }
@@ -1144,7 +1373,8 @@ namespace jsoncons {
         order_preserving_json_object(std::initializer_list<std::pair<std::basic_string<char_type>,Json>> init, 
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
             members_.reserve(init.size());
             for (auto& item : init)
@@ -1168,12 +1398,14 @@ namespace jsoncons {
         {
             allocator_holder<allocator_type>::operator=(val.get_allocator());
             members_ = val.members_;
+            index_ = val.index_;
             return *this;
         }
 
         void swap(order_preserving_json_object& other) noexcept
         {
             members_.swap(other.members_);
+            index_.swap(other.index_);
         }
 
         bool empty() const
@@ -1208,6 +1440,7 @@ namespace jsoncons {
         void clear() 
         {
             members_.clear();
+            index_.clear();
         }
 
         void shrink_to_fit() 
@@ -1241,6 +1474,10 @@ namespace jsoncons {
 
         iterator find(const string_view_type& name) noexcept
         {
+            if (!index_.empty())
+            {
+                return members_.begin() + find_in_index(name);
+            }
             bool found = false;
             auto it = members_.begin();
             while (!found && it != members_.end())
@@ -1259,6 +1496,10 @@ namespace jsoncons {
 
         const_iterator find(const string_view_type& name) const noexcept
         {
+            if (!index_.empty())
+            {
+                return members_.begin() + find_in_index(name);
+            }
             bool found = false;
             auto it = members_.begin();
             while (!found && it != members_.end())
@@ -1281,10 +1522,12 @@ namespace jsoncons {
             {
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
                 iterator it = members_.begin() + (pos - members_.begin());
-                return members_.erase(it);
+                it = members_.erase(it);
     #else
-                return members_.erase(pos);
+                iterator it = members_.erase(pos);
     #endif
+                unindex_members();
+                return it;
             }
             else
             {
@@ -1303,10 +1546,12 @@ namespace jsoncons {
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
                 iterator it1 = members_.begin() + (first - members_.begin());
                 iterator it2 = members_.begin() + (last - members_.begin());
-                return members_.erase(it1,it2);
+                iterator it = members_.erase(it1,it2);
     #else
-                return members_.erase(first,last);
+                iterator it = members_.erase(first,last);
     #endif
+                unindex_members();
+                return it;
             }
             else
             {
@@ -1325,6 +1570,7 @@ namespace jsoncons {
     #else
                 members_.erase(pos);
     #endif
+                unindex_members();
             }
         }
 
@@ -1372,6 +1618,7 @@ namespace jsoncons {
                 for (auto it = first; it != last; ++it)
                 {
                     members_.emplace_back(std::move(it->name), std::move(it->value));
+                    index_member(members_.size()-1);
                 }
             }
         }
@@ -1387,6 +1634,7 @@ namespace jsoncons {
                 {
                     keys.emplace(kv.key());
                     members_.emplace_back(std::move(kv));
+                    index_member(members_.size()-1);
                 }
             }
         }
@@ -1397,6 +1645,17 @@ namespace jsoncons {
             for (auto it = first; it != last; ++it)
             {
                 members_.emplace_back(get_key_value<KeyT,Json>()(*it));
+                index_member(members_.size()-1);
+            }
+        }
+
+        template<class InputIt,class=typename std::enable_if<!std::is_convertible<InputIt,string_view_type>::value,typename std::iterator_traits<InputIt>::iterator_category>::type>
+        void insert_or_assign(InputIt first, InputIt last)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                auto kv = get_key_value<KeyT,Json>()(*it);
+                insert_or_assign(kv.key(), std::move(kv.value()));
             }
         }
    
@@ -1408,6 +1667,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(), name.end()), std::forward<T>(value));
+                index_member(members_.size()-1);
                 auto pos = members_.begin() + (members_.size() - 1);
                 return std::make_pair(pos, true);
             }
@@ -1426,6 +1686,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(),get_allocator()), std::forward<T>(value));
+                index_member(members_.size()-1);
                 auto pos = members_.begin() + (members_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -1451,6 +1712,7 @@ namespace jsoncons {
                 if (it == members_.end())
                 {
                     members_.emplace_back(key_type(key.begin(), key.end()), std::forward<T>(value));
+                    index_member(members_.size()-1);
                     auto pos = members_.begin() + (members_.size() - 1);
                     return pos;
                 }
@@ -1477,6 +1739,7 @@ namespace jsoncons {
                 if (it == members_.end())
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(),get_allocator()), std::forward<T>(value));
+                    index_member(members_.size()-1);
                     auto pos = members_.begin() + (members_.size()-1);
                     return pos;
                 }
@@ -1631,6 +1894,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(), name.end()), std::forward<Args>(args)...);
+                index_member(members_.size()-1);
                 auto pos = members_.begin() + (members_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -1649,6 +1913,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                     std::forward<Args>(args)...);
+                index_member(members_.size()-1);
                 auto pos = members_.begin() + members_.size();
                 return std::make_pair(pos,true);
             }
@@ -1674,6 +1939,7 @@ namespace jsoncons {
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
+                    index_member(members_.size()-1);
                     auto pos = members_.begin() + members_.size();
                     return pos;
                 }
@@ -1700,6 +1966,7 @@ namespace jsoncons {
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
+                    index_member(members_.size()-1);
                     auto pos = members_.begin() + members_.size();
                     return pos;
                 }
@@ -1723,6 +1990,10 @@ namespace jsoncons {
 
         iterator find(iterator hint, const string_view_type& name) noexcept
         {
+            if (!index_.empty())
+            {
+                return find(name);
+            }
             bool found = false;
             auto it = hint;
             while (!found && it != members_.end())
@@ -1739,6 +2010,104 @@ namespace jsoncons {
             return found ? it : find(name);
         }
 
+        // Adds members_[pos] to the index, building the index once the object reaches 
+        // index_threshold members and growing it to keep the load factor at most one half
+        void index_member(std::size_t pos) noexcept
+        {
+            if (index_.empty() ? members_.size() >= index_threshold : 2*members_.size() > index_.size())
+            {
+                reindex();
+            }
+            else if (!index_.empty())
+            {
+                insert_in_index(pos);
+            }
+        }
+
+        // Rebuilds the index in place after members are erased. The table is at least as
+        // large as the members need, so this does not allocate.
+        void unindex_members() noexcept
+        {
+            if (members_.size() < index_threshold)
+            {
+                index_.clear();
+                return;
+            }
+            if (index_.empty())
+            {
+                return;
+            }
+            std::fill(index_.begin(), index_.end(), 0);
+            for (std::size_t pos = 0; pos < members_.size(); ++pos)
+            {
+                insert_in_index(pos);
+            }
+        }
+
+        // Builds a new table for the members. Members are inserted before they are indexed, so
+        // should allocating the table fail, the index is dropped rather than the exception let
+        // out, and lookups fall back to a linear search until the next reindex.
+        void reindex() noexcept
+        {
+            index_.clear();
+            if (members_.size() < index_threshold)
+            {
+                return;
+            }
+            std::size_t length = 4*index_threshold;
+            while (length < 4*members_.size())
+            {
+                length *= 2;
+            }
+            JSONCONS_TRY
+            {
+                index_container_type index(length, 0, index_.get_allocator());
+                for (std::size_t pos = 0; pos < members_.size(); ++pos)
+                {
+                    insert_in_index(index, pos);
+                }
+                index_.swap(index);
+            }
+            JSONCONS_CATCH(...)
+            {
+                index_.clear();
+            }
+        }
+
+        void insert_in_index(std::size_t pos)
+        {
+            insert_in_index(index_, pos);
+        }
+
+        // Members with the same key are probed in position order, so the first one is found as with a linear search
+        void insert_in_index(index_container_type& index, std::size_t pos) const
+        {
+            const std::size_t mask = index.size() - 1;
+            const key_type& key = members_[pos].key();
+            std::size_t slot = hash_key(key.data(), key.size()) & mask;
+            while (index[slot] != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+            index[slot] = pos + 1;
+        }
+
+        std::size_t find_in_index(const string_view_type& name) const noexcept
+        {
+            const std::size_t mask = index_.size() - 1;
+            std::size_t slot = hash_key(name.data(), name.size()) & mask;
+            while (index_[slot] != 0)
+            {
+                const std::size_t pos = index_[slot] - 1;
+                if (members_[pos].key() == name)
+                {
+                    return pos;
+                }
+                slot = (slot + 1) & mask;
+            }
+            return members_.size();
+        }
+
         void flatten_and_destroy() noexcept
         {
             if (!members_.empty())
@@ -1764,6 +2133,13 @@ namespace jsoncons {
         }
     };
 
+#if __cplusplus >= 201703L
+// not needed for C++17
+#else
+    template <class KeyT,class Json,template<typename,typename> class SequenceContainer>
+    constexpr std::size_t order_preserving_json_object<KeyT,Json,SequenceContainer>::index_threshold;
+#endif
+
 } // namespace jsoncons
 
 #endif
@@ -46,6 +46,8 @@ enum class byte_string_chars_format : uint8_t {none=0,base16,base64,base64url};
 
 enum class spaces_option : uint8_t {no_spaces=0,space_after,space_before,space_before_and_after};
 
+enum class structural_index_kind : uint8_t {none=0,indented,all};
+
 
 struct default_json_parsing
 {
@@ -361,17 +363,18 @@ public:
     using typename super_type::string_type;
 private:
     bool lossless_number_;
+    structural_index_kind structural_index_;
     std::function<bool(json_errc,const ser_context&)> err_handler_;
 public:
     basic_json_decode_options()
-        : lossless_number_(false), err_handler_(default_json_parsing())
+        : lossless_number_(false), structural_index_(structural_index_kind::none), err_handler_(default_json_parsing())
     {
     }
 
     basic_json_decode_options(const basic_json_decode_options&) = default;
 
     basic_json_decode_options(basic_json_decode_options&& other)
-        : super_type(std::move(other)), lossless_number_(other.lossless_number_), err_handler_(std::move(other.err_handler_))
+        : super_type(std::move(other)), lossless_number_(other.lossless_number_), structural_index_(other.structural_index_), err_handler_(std::move(other.err_handler_))
     {
     }
 
@@ -382,6 +385,11 @@ public:
         return lossless_number_;
     }
 
+    structural_index_kind structural_index() const 
+    {
+        return structural_index_;
+    }
+
     const std::function<bool(json_errc,const ser_context&)>& err_handler() const 
     {
         return err_handler_;
@@ -585,6 +593,7 @@ public:
     using basic_json_decode_options<CharT>::neginf_to_num;
 
     using basic_json_decode_options<CharT>::lossless_number;
+    using basic_json_decode_options<CharT>::structural_index;
     using basic_json_decode_options<CharT>::err_handler;
 
     using basic_json_encode_options<CharT>::byte_string_format;
@@ -767,6 +776,18 @@ public:
         return *this;
     }
 
+    basic_json_options& structural_index(structural_index_kind value) 
+    {
+        this->structural_index_ = value;
+        return *this;
+    }
+
+    basic_json_options& structural_index(bool value) 
+    {
+        this->structural_index_ = value ? structural_index_kind::indented : structural_index_kind::none;
+        return *this;
+    }
+
     basic_json_options& err_handler(const std::function<bool(json_errc,const ser_context&)>& value) 
     {
         this->err_handler_ = value;
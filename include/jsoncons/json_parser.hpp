@@ -15,12 +15,15 @@
 #include <unordered_map>
 #include <limits> // std::numeric_limits
 #include <functional> // std::function
+#include <algorithm> // std::replace
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_filter.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd.hpp>
+#include <jsoncons/detail/structural_index.hpp>
 
 #define JSONCONS_ILLEGAL_CONTROL_CHARACTER \
         case 0x00:case 0x01:case 0x02:case 0x03:case 0x04:case 0x05:case 0x06:case 0x07:case 0x08:case 0x0b: \
@@ -105,9 +108,11 @@ private:
     using temp_allocator_type = TempAllocator;
     using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
     using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_parse_state>;
+    using index_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint32_t>;
 
     static constexpr std::size_t initial_string_buffer_capacity_ = 1024;
     static constexpr std::size_t default_initial_stack_capacity_ = 100;
+    static constexpr std::size_t structural_window_size_ = 16384;
 
     basic_json_decode_options<char_type> options_;
 
@@ -133,6 +138,16 @@ private:
     std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
     std::vector<std::pair<std::basic_string<char_type>,double>> string_double_map_;
 
+    jsoncons::detail::structural_scanner scanner_;
+    std::vector<uint32_t,index_allocator_type> structural_index_;
+    std::size_t index_length_;
+    const char_type* index_base_;
+    const char_type* index_end_;
+    std::size_t index_pos_;
+    bool index_done_;
+
+    jsoncons::detail::structure_skipper skipper_;
+
     // Noncopyable and nonmoveable
     basic_json_parser(const basic_json_parser&) = delete;
     basic_json_parser& operator=(const basic_json_parser&) = delete;
@@ -175,7 +190,13 @@ public:
          more_(true),
          done_(false),
          string_buffer_(temp_alloc),
-         state_stack_(temp_alloc)
+         state_stack_(temp_alloc),
+         structural_index_(temp_alloc),
+         index_length_(0),
+         index_base_(nullptr),
+         index_end_(nullptr),
+         index_pos_(0),
+         index_done_(false)
     {
         string_buffer_.reserve(initial_string_buffer_capacity_);
 
@@ -261,13 +282,16 @@ public:
         const char_type* local_input_end = end_input_;
         while (input_ptr_ != local_input_end) 
         {
+            // Runs of spaces and tabs, e.g. indentation, are skipped a block at a time
+            const char_type* p = jsoncons::detail::skip_blanks(input_ptr_, local_input_end);
+            position_ += (p - input_ptr_);
+            input_ptr_ = p;
+            if (input_ptr_ == local_input_end)
+            {
+                return;
+            }
             switch (*input_ptr_)
             {
-                case ' ':
-                case '\t':
-                    ++input_ptr_;
-                    ++position_;
-                    break;
                 case '\r': 
                     push_state(state_);
                     ++input_ptr_;
@@ -279,7 +303,7 @@ public:
                     ++line_;
                     ++position_;
                     mark_position_ = position_;
-                    return;   
+                    break;   
                 default:
                     return;
             }
@@ -451,6 +475,8 @@ public:
         end_input_ = nullptr;
         input_ptr_ = nullptr;
         string_buffer_.clear();
+        index_base_ = nullptr;
+        index_done_ = false;
     }
 
     void reset()
@@ -472,6 +498,46 @@ public:
         more_ = true;
     }
 
+    // Starts skipping the array or object whose begin event was the last one reported
+    void begin_skip()
+    {
+        skipper_.reset();
+    }
+
+    // Consumes input up to the end of the array or object being skipped, without reporting events
+    // or validating the contents. Returns true when the closing bracket has been consumed, which
+    // leaves the parser as if the end event had been reported, and false if more input is needed.
+    bool skip_some()
+    {
+        std::size_t count = skipper_.skip(input_ptr_, end_input_);
+        if (skipper_.line_breaks() > 0)
+        {
+            line_ += skipper_.line_breaks();
+            mark_position_ = position_ + skipper_.line_start();
+        }
+        input_ptr_ += count;
+        position_ += count;
+        if (!skipper_.done())
+        {
+            return false;
+        }
+
+        --nesting_depth_;
+        pop_state();
+        if (parent() == json_parse_state::root)
+        {
+            state_ = json_parse_state::accept;
+        }
+        else
+        {
+            state_ = json_parse_state::expect_comma_or_end;
+        }
+        // The structural index does not cover the skipped input
+        index_base_ = nullptr;
+        index_done_ = false;
+        return true;
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -516,6 +582,8 @@ public:
         begin_input_ = data;
         end_input_ = data + length;
         input_ptr_ = begin_input_;
+        index_base_ = nullptr;
+        index_done_ = false;
     }
 
     void parse_some(basic_json_visitor<char_type>& visitor)
@@ -598,6 +666,12 @@ public:
             }
         }
 
+        if (options_.structural_index() != structural_index_kind::none && !index_done_ && (input_ptr_ < local_input_end) && more_)
+        {
+            parse_indexed(visitor, ec);
+            if (ec) return;
+        }
+
         while ((input_ptr_ < local_input_end) && more_)
         {
             switch (state_)
@@ -635,19 +709,7 @@ public:
                                     return;
                                 }
                                 break;
-                            case '\r': 
-                                push_state(state_);
-                                ++input_ptr_;
-                                ++position_;
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/': 
@@ -754,19 +816,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                ++input_ptr_;
-                                ++position_;
-                                push_state(state_);
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/':
@@ -834,19 +884,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                ++input_ptr_;
-                                ++position_;
-                                push_state(state_);
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/':
@@ -909,19 +947,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                ++input_ptr_;
-                                ++position_;
-                                push_state(state_);
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/': 
@@ -990,19 +1016,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                push_state(state_);
-                                state_ = json_parse_state::cr;
-                                ++input_ptr_;
-                                ++position_;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/': 
@@ -1044,19 +1058,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                push_state(state_);
-                                ++input_ptr_;
-                                ++position_;
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/': 
@@ -1192,19 +1194,7 @@ public:
                                 ++input_ptr_;
                                 ++position_;
                                 break;
-                            case '\r': 
-                                ++input_ptr_;
-                                ++position_;
-                                push_state(state_);
-                                state_ = json_parse_state::cr;
-                                break; 
-                            case '\n': 
-                                ++input_ptr_;
-                                ++line_;
-                                ++position_;
-                                mark_position_ = position_;
-                                break;   
-                            case ' ':case '\t':
+                            case ' ':case '\t':case '\n':case '\r':
                                 skip_space();
                                 break;
                             case '/': 
@@ -1769,23 +1759,7 @@ zero:
         }
         switch (*input_ptr_)
         {
-            case '\r': 
-                end_integer_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++position_;
-                push_state(state_);
-                state_ = json_parse_state::cr;
-                return; 
-            case '\n': 
-                end_integer_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++line_;
-                ++position_;
-                mark_position_ = position_;
-                return;   
-            case ' ':case '\t':
+            case ' ':case '\t':case '\n':case '\r':
                 end_integer_value(visitor, ec);
                 if (ec) return;
                 skip_space();
@@ -1843,23 +1817,7 @@ integer:
         }
         switch (*input_ptr_)
         {
-            case '\r': 
-                end_integer_value(visitor, ec);
-                if (ec) return;
-                push_state(state_);
-                ++input_ptr_;
-                ++position_;
-                state_ = json_parse_state::cr;
-                return; 
-            case '\n': 
-                end_integer_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++line_;
-                ++position_;
-                mark_position_ = position_;
-                return;   
-            case ' ':case '\t':
+            case ' ':case '\t':case '\n':case '\r':
                 end_integer_value(visitor, ec);
                 if (ec) return;
                 skip_space();
@@ -1936,23 +1894,7 @@ fraction2:
         }
         switch (*input_ptr_)
         {
-            case '\r': 
-                end_fraction_value(visitor, ec);
-                if (ec) return;
-                push_state(state_);
-                ++input_ptr_;
-                ++position_;
-                state_ = json_parse_state::cr;
-                return; 
-            case '\n': 
-                end_fraction_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++line_;
-                ++position_;
-                mark_position_ = position_;
-                return;   
-            case ' ':case '\t':
+            case ' ':case '\t':case '\n':case '\r':
                 end_fraction_value(visitor, ec);
                 if (ec) return;
                 skip_space();
@@ -2058,23 +2000,7 @@ exp3:
         }
         switch (*input_ptr_)
         {
-            case '\r': 
-                end_fraction_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++position_;
-                push_state(state_);
-                state_ = json_parse_state::cr;
-                return; 
-            case '\n': 
-                end_fraction_value(visitor, ec);
-                if (ec) return;
-                ++input_ptr_;
-                ++line_;
-                ++position_;
-                mark_position_ = position_;
-                return;   
-            case ' ':case '\t':
+            case ' ':case '\t':case '\n':case '\r':
                 end_fraction_value(visitor, ec);
                 if (ec) return;
                 skip_space();
@@ -2159,6 +2085,11 @@ exp3:
 string_u1:
         while (input_ptr_ < local_input_end)
         {
+            input_ptr_ = jsoncons::detail::find_string_special(input_ptr_, local_input_end);
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2637,6 +2568,432 @@ escape_u8:
     }
 private:
 
+    static bool is_token_boundary(json_parse_state state)
+    {
+        switch (state)
+        {
+            case json_parse_state::start:
+            case json_parse_state::accept:
+            case json_parse_state::expect_comma_or_end:
+            case json_parse_state::expect_member_name_or_end:
+            case json_parse_state::expect_member_name:
+            case json_parse_state::expect_colon:
+            case json_parse_state::expect_value_or_end:
+            case json_parse_state::expect_value:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Second stage of the two stage parse. Stage one, detail::structural_scanner, records 
+    // the offsets of the characters that this loop stops at, so whitespace and the contents 
+    // of strings without escapes are never looked at one character at a time. The common cases 
+    // are handled here with the same state transitions as parse_some_. On anything else, 
+    // e.g. a comment, a string with escapes split by the end of the buffer, or an error, 
+    // the parser state is left in sync with input_ptr_ and parse_some_ takes over for the 
+    // rest of the buffer.
+
+    void parse_indexed(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        if (index_base_ == nullptr)
+        {
+            if (!is_token_boundary(state_) || 
+                (options_.structural_index() == structural_index_kind::indented && !jsoncons::detail::is_indented_text(input_ptr_, end_input_)))
+            {
+                index_done_ = true;
+                return;
+            }
+            scanner_.reset();
+            index_length_ = 0;
+            index_base_ = input_ptr_;
+            index_end_ = input_ptr_;
+            index_pos_ = 0;
+        }
+
+        const char_type* local_input_end = end_input_;
+        // A carriage return consumed by skip_space after a number
+        if (state_ == json_parse_state::cr)
+        {
+            ++line_;
+            mark_position_ = position_;
+            if (*input_ptr_ == '\n')
+            {
+                ++input_ptr_;
+                ++position_;
+            }
+            state_ = pop_state();
+        }
+        // The index cursor is kept in locals, and stored back in index_pos_ only when the loop 
+        // stops before the end of the input
+        const uint32_t* it = structural_index_.data() + index_pos_;
+        const uint32_t* it_end = structural_index_.data() + index_length_;
+        while (more_ && state_ != json_parse_state::accept)
+        {
+            if (it == it_end)
+            {
+                if (index_end_ == local_input_end)
+                {
+                    index_done_ = true;
+                    return;
+                }
+                index_base_ = index_end_;
+                index_end_ = static_cast<std::size_t>(local_input_end - index_base_) > structural_window_size_ ? index_base_ + structural_window_size_ : local_input_end;
+                // The index buffer only grows, so it is value-initialized once rather than every window
+                std::size_t index_capacity = static_cast<std::size_t>(index_end_ - index_base_) + 64;
+                if (structural_index_.size() < index_capacity)
+                {
+                    structural_index_.resize(index_capacity);
+                }
+                if (!scanner_.scan(index_base_, index_end_, structural_index_.data(), index_length_))
+                {
+                    index_done_ = true;
+                    return;
+                }
+                it = structural_index_.data();
+                it_end = it + index_length_;
+                continue;
+            }
+            const char_type* p = index_base_ + *it++;
+            if (p < input_ptr_) // already consumed
+            {
+                continue;
+            }
+            position_ += (p - input_ptr_);
+            input_ptr_ = p;
+
+            switch (*p)
+            {
+                case '\n':
+                    ++input_ptr_;
+                    ++line_;
+                    ++position_;
+                    mark_position_ = position_;
+                    continue;
+                case '\r':
+                    if (p + 1 == local_input_end)
+                    {
+                        index_done_ = true;
+                        return;
+                    }
+                    ++input_ptr_;
+                    ++position_;
+                    ++line_;
+                    mark_position_ = position_;
+                    if (*input_ptr_ == '\n')
+                    {
+                        ++input_ptr_;
+                        ++position_;
+                    }
+                    continue;
+                default:
+                    break;
+            }
+
+            switch (state_)
+            {
+                case json_parse_state::start:
+                case json_parse_state::expect_value_or_end:
+                case json_parse_state::expect_value:
+                    switch (*p)
+                    {
+                        case '{':
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            begin_object(visitor, ec);
+                            break;
+                        case '[':
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            begin_array(visitor, ec);
+                            break;
+                        case ']':
+                            if (state_ != json_parse_state::expect_value_or_end)
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_array(visitor, ec);
+                            break;
+                        case '\"':
+                            saved_position_ = position_;
+                            if (!parse_indexed_string(it, it_end, visitor, ec))
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            break;
+                        case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
+                            if (parent() == json_parse_state::root || !parse_indexed_number(visitor, ec))
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            break;
+                        case 't':
+                            if (parent() == json_parse_state::root || local_input_end - p < 5)
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            parse_true(visitor, ec);
+                            break;
+                        case 'f':
+                            if (parent() == json_parse_state::root || local_input_end - p < 6)
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            parse_false(visitor, ec);
+                            break;
+                        case 'n':
+                            if (parent() == json_parse_state::root || local_input_end - p < 5)
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            parse_null(visitor, ec);
+                            break;
+                        default:
+                            index_done_ = true;
+                            return;
+                    }
+                    break;
+                case json_parse_state::expect_member_name_or_end:
+                case json_parse_state::expect_member_name:
+                    switch (*p)
+                    {
+                        case '\"':
+                            saved_position_ = position_;
+                            push_state(json_parse_state::member_name);
+                            if (!parse_indexed_string(it, it_end, visitor, ec))
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            break;
+                        case '}':
+                            if (state_ != json_parse_state::expect_member_name_or_end)
+                            {
+                                index_done_ = true;
+                                return;
+                            }
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_object(visitor, ec);
+                            break;
+                        default:
+                            index_done_ = true;
+                            return;
+                    }
+                    break;
+                case json_parse_state::expect_colon:
+                    if (*p != ':')
+                    {
+                        index_done_ = true;
+                        return;
+                    }
+                    state_ = json_parse_state::expect_value;
+                    ++input_ptr_;
+                    ++position_;
+                    break;
+                case json_parse_state::expect_comma_or_end:
+                    switch (*p)
+                    {
+                        case '}':
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_object(visitor, ec);
+                            break;
+                        case ']':
+                            saved_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_array(visitor, ec);
+                            break;
+                        case ',':
+                            begin_member_or_element(ec);
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        default:
+                            index_done_ = true;
+                            return;
+                    }
+                    break;
+                default:
+                    index_done_ = true;
+                    return;
+            }
+            if (ec)
+            {
+                index_done_ = true;
+                return;
+            }
+            // Stage one indexes the first character of a token only, so a literal must be 
+            // followed by a character that it indexes, or a blank 
+            if ((*p == 't' || *p == 'f' || *p == 'n') && input_ptr_ < local_input_end)
+            {
+                switch (*input_ptr_)
+                {
+                    case ' ':case '\t':case '\n':case '\r':
+                    case ',':case ':':case ']':case '}':case '{':case '[':case '\"':
+                        break;
+                    default:
+                        index_done_ = true;
+                        return;
+                }
+            }
+        }
+        index_pos_ = static_cast<std::size_t>(it - structural_index_.data());
+    }
+
+    // it refers to the index entry following the opening quotation mark. Returns false if 
+    // the string is cut short by the end of the buffer.
+    bool parse_indexed_string(const uint32_t*& it, const uint32_t* it_end, 
+                              basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        const char_type* sb = input_ptr_ + 1;
+        // If the next indexed character is the closing quotation mark, there are no escapes or 
+        // control characters in between
+        if (it != it_end && index_base_[*it] == '\"')
+        {
+            const char_type* se = index_base_ + *it++;
+            position_ += (se - input_ptr_ + 1);
+            input_ptr_ = se;
+            end_string_value(sb, se - sb, visitor, ec);
+            ++input_ptr_;
+            return true;
+        }
+        else
+        {
+            ++input_ptr_;
+            ++position_;
+            state_ = json_parse_state::string;
+            string_buffer_.clear();
+            parse_string(visitor, ec);
+            return is_token_boundary(state_);
+        }
+    }
+
+    // Returns false, without consuming anything, unless the number is well formed and 
+    // followed by a delimiter in the current buffer
+    bool parse_indexed_number(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        const char_type* local_input_end = end_input_;
+        const char_type* p = input_ptr_;
+        bool is_integer = true;
+
+        if (*p == '-')
+        {
+            ++p;
+        }
+        if (p == local_input_end)
+        {
+            return false;
+        }
+        if (*p == '0')
+        {
+            ++p;
+        }
+        else if (*p >= '1' && *p <= '9')
+        {
+            ++p;
+            while (p != local_input_end && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        if (p != local_input_end && *p == '.')
+        {
+            is_integer = false;
+            ++p;
+            const char_type* digits = p;
+            while (p != local_input_end && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+            if (p == digits)
+            {
+                return false;
+            }
+        }
+        if (p != local_input_end && (*p == 'e' || *p == 'E'))
+        {
+            is_integer = false;
+            ++p;
+            if (p != local_input_end && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            const char_type* digits = p;
+            while (p != local_input_end && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+            if (p == digits)
+            {
+                return false;
+            }
+        }
+        if (p == local_input_end)
+        {
+            return false;
+        }
+        switch (*p)
+        {
+            case ' ':case '\t':case '\n':case '\r':case ',':case ']':case '}':
+                break;
+            default:
+                return false;
+        }
+
+        string_buffer_.assign(input_ptr_, p - input_ptr_);
+        saved_position_ = position_;
+        position_ += (p - input_ptr_);
+        input_ptr_ = p;
+        if (is_integer)
+        {
+            end_integer_value(visitor, ec);
+        }
+        else
+        {
+            std::replace(string_buffer_.begin(), string_buffer_.end(), static_cast<char_type>('.'), static_cast<char_type>(to_double_.get_decimal_point()));
+            end_fraction_value(visitor, ec);
+        }
+        // If the visitor stops the parse, the delimiter is consumed as parse_number consumes it,
+        // so that line and column are the same as in parse_some_
+        if (!more_ && !ec)
+        {
+            switch (*input_ptr_)
+            {
+                case ' ':case '\t':case '\n':case '\r':
+                    skip_space();
+                    break;
+                case ',':
+                    begin_member_or_element(ec);
+                    if (ec) return true;
+                    ++input_ptr_;
+                    ++position_;
+                    break;
+                default:
+                    break;
+            }
+        }
+        return true;
+    }
+
     void end_integer_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
         if (string_buffer_[0] == '-')
@@ -0,0 +1,1155 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_TAPE_HPP
+#define JSONCONS_JSON_TAPE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/detail/fnv1a.hpp>
+
+namespace jsoncons {
+
+    template <class CharT>
+    class basic_json_tape;
+
+    template <class CharT>
+    class basic_json_tape_decoder;
+
+namespace detail {
+
+    // The kind of a tape word, kept in its top byte. A word also holds the semantic tag of its
+    // value in the next byte, and a 48 bit payload.
+    //
+    // null, true, false                one word
+    // half, integers that fit 48 bits  one word with the value
+    // int64, uint64, double            one word and the value
+    // short key, short string          one word with the offset in the string arena and the length
+    // long key, long string            one word with the offset in the string arena, and the length
+    // byte string                      one word with the offset in the byte arena, and the length
+    // byte string with extension tag   the same, and the extension tag
+    // begin object, begin array        one word with the index just past the matching end word
+    // end object, end array            one word with the size of the container
+
+    enum class tape_kind : uint8_t
+    {
+        null_value = 'n',
+        true_value = 't',
+        false_value = 'f',
+        small_int64_value = 'i',
+        small_uint64_value = 'v',
+        int64_value = 'l',
+        uint64_value = 'u',
+        half_value = 'h',
+        double_value = 'd',
+        short_key = 'k',
+        key = 'K',
+        short_string_value = 's',
+        string_value = 'S',
+        byte_string_value = 'b',
+        ext_byte_string_value = 'x',
+        begin_object = '{',
+        end_object = '}',
+        begin_array = '[',
+        end_array = ']'
+    };
+
+    struct tape_word
+    {
+        static constexpr uint64_t payload_mask = (uint64_t(1) << 48) - 1;
+
+        static uint64_t make(tape_kind kind, semantic_tag tag, uint64_t payload)
+        {
+            return (uint64_t(kind) << 56) | (uint64_t(tag) << 48) | payload;
+        }
+
+        static tape_kind kind(uint64_t word)
+        {
+            return static_cast<tape_kind>(word >> 56);
+        }
+
+        static semantic_tag tag(uint64_t word)
+        {
+            return static_cast<semantic_tag>((word >> 48) & 0xff);
+        }
+
+        static std::size_t payload(uint64_t word)
+        {
+            return static_cast<std::size_t>(word & payload_mask);
+        }
+
+        // The payload read as a 48 bit two's complement integer
+        static int64_t signed_payload(uint64_t word)
+        {
+            return static_cast<int64_t>(word << 16) >> 16;
+        }
+
+        static bool fits_signed_payload(int64_t value)
+        {
+            return value >= -(int64_t(1) << 47) && value < (int64_t(1) << 47);
+        }
+
+        // A short string keeps its offset in the high 32 bits of the payload and its length in the low 16
+        static bool fits_short_string(std::size_t offset, std::size_t length)
+        {
+            return offset <= 0xffffffff && length <= 0xffff;
+        }
+
+        static uint64_t short_string_payload(std::size_t offset, std::size_t length)
+        {
+            return (uint64_t(offset) << 16) | uint64_t(length);
+        }
+    };
+
+    // A string or string view of CharT
+    template <class T,class CharT,class Enable=void>
+    struct is_tape_text : std::false_type {};
+
+    template <class T,class CharT>
+    struct is_tape_text<T,CharT,
+                        typename std::enable_if<(extension_traits::is_string<T>::value || extension_traits::is_string_view<T>::value) &&
+                                                std::is_same<typename T::value_type,CharT>::value
+    >::type> : std::true_type {};
+
+} // namespace detail
+
+    // basic_tape_value
+
+    // A view of one value of a basic_json_tape. It is valid as long as the tape is.
+
+    template <class CharT>
+    class basic_tape_value
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        using tape_type = basic_json_tape<char_type>;
+    private:
+        using kind = detail::tape_kind;
+        using word = detail::tape_word;
+
+        const tape_type* tape_;
+        std::size_t index_;
+
+        template <class Value>
+        class member_iterator
+        {
+            const tape_type* tape_;
+            std::size_t index_;
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Value;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Value*;
+            using reference = Value;
+
+            member_iterator()
+                : tape_(nullptr), index_(0)
+            {
+            }
+
+            member_iterator(const tape_type* tape, std::size_t index)
+                : tape_(tape), index_(index)
+            {
+            }
+
+            Value operator*() const
+            {
+                return make_item(tape_, index_, static_cast<Value*>(nullptr));
+            }
+
+            member_iterator& operator++()
+            {
+                index_ = next_item(tape_, index_, static_cast<Value*>(nullptr));
+                return *this;
+            }
+
+            member_iterator operator++(int)
+            {
+                member_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            friend bool operator==(const member_iterator& lhs, const member_iterator& rhs)
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const member_iterator& lhs, const member_iterator& rhs)
+            {
+                return lhs.index_ != rhs.index_;
+            }
+        };
+    public:
+        // A member of an object
+        class key_value_type;
+
+        using object_iterator = member_iterator<key_value_type>;
+        using array_iterator = member_iterator<basic_tape_value>;
+
+        basic_tape_value(const tape_type* tape, std::size_t index)
+            : tape_(tape), index_(index)
+        {
+        }
+
+        json_type type() const
+        {
+            switch (word::kind(at_word(0)))
+            {
+                case kind::null_value:
+                    return json_type::null_value;
+                case kind::true_value:
+                case kind::false_value:
+                    return json_type::bool_value;
+                case kind::small_int64_value:
+                case kind::int64_value:
+                    return json_type::int64_value;
+                case kind::small_uint64_value:
+                case kind::uint64_value:
+                    return json_type::uint64_value;
+                case kind::half_value:
+                    return json_type::half_value;
+                case kind::double_value:
+                    return json_type::double_value;
+                case kind::byte_string_value:
+                case kind::ext_byte_string_value:
+                    return json_type::byte_string_value;
+                case kind::begin_array:
+                    return json_type::array_value;
+                case kind::begin_object:
+                    return json_type::object_value;
+                default:
+                    return json_type::string_value;
+            }
+        }
+
+        semantic_tag tag() const
+        {
+            return word::tag(at_word(0));
+        }
+
+        bool is_null() const
+        {
+            return word::kind(at_word(0)) == kind::null_value;
+        }
+
+        bool is_bool() const
+        {
+            return type() == json_type::bool_value;
+        }
+
+        bool is_string() const
+        {
+            return type() == json_type::string_value;
+        }
+
+        bool is_byte_string() const
+        {
+            return type() == json_type::byte_string_value;
+        }
+
+        bool is_int64() const
+        {
+            return type() == json_type::int64_value;
+        }
+
+        bool is_uint64() const
+        {
+            return type() == json_type::uint64_value;
+        }
+
+        bool is_double() const
+        {
+            return word::kind(at_word(0)) == kind::double_value || word::kind(at_word(0)) == kind::half_value;
+        }
+
+        bool is_number() const
+        {
+            return is_int64() || is_uint64() || is_double();
+        }
+
+        bool is_object() const
+        {
+            return word::kind(at_word(0)) == kind::begin_object;
+        }
+
+        bool is_array() const
+        {
+            return word::kind(at_word(0)) == kind::begin_array;
+        }
+
+        // Number of members of an object or elements of an array, 0 for other values
+        std::size_t size() const
+        {
+            return is_object() || is_array() ? word::payload(tape_->words_[next_index() - 1]) : 0;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        bool contains(const string_view_type& key) const
+        {
+            return is_object() && find(key) != 0;
+        }
+
+        basic_tape_value at(const string_view_type& key) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(not_an_object(key.data(),key.length()));
+            }
+            std::size_t index = find(key);
+            if (index == 0)
+            {
+                JSONCONS_THROW(key_not_found(key.data(),key.length()));
+            }
+            return basic_tape_value(tape_, index);
+        }
+
+        basic_tape_value operator[](const string_view_type& key) const
+        {
+            return at(key);
+        }
+
+        basic_tape_value at(std::size_t i) const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+            }
+            if (i >= size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            std::size_t index = index_ + 1;
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                index = basic_tape_value(tape_, index).next_index();
+            }
+            return basic_tape_value(tape_, index);
+        }
+
+        basic_tape_value operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        range<object_iterator,object_iterator> object_range() const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            return range<object_iterator,object_iterator>(object_iterator(tape_, index_ + 1),
+                                                          object_iterator(tape_, next_index() - 1));
+        }
+
+        range<array_iterator,array_iterator> array_range() const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return range<array_iterator,array_iterator>(array_iterator(tape_, index_ + 1),
+                                                        array_iterator(tape_, next_index() - 1));
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            switch (word::kind(at_word(0)))
+            {
+                case kind::true_value:
+                    return true;
+                case kind::false_value:
+                    return false;
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+            }
+        }
+
+        template <class T>
+        typename std::enable_if<extension_traits::is_integer<T>::value && !std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            switch (word::kind(at_word(0)))
+            {
+                case kind::small_int64_value:
+                case kind::int64_value:
+                    return static_cast<T>(int64_value());
+                case kind::small_uint64_value:
+                case kind::uint64_value:
+                    return static_cast<T>(uint64_value());
+                case kind::half_value:
+                case kind::double_value:
+                    return static_cast<T>(as_double());
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an integer"));
+            }
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_floating_point<T>::value,T>::type
+        as() const
+        {
+            switch (word::kind(at_word(0)))
+            {
+                case kind::small_int64_value:
+                case kind::int64_value:
+                    return static_cast<T>(int64_value());
+                case kind::small_uint64_value:
+                case kind::uint64_value:
+                    return static_cast<T>(uint64_value());
+                case kind::half_value:
+                case kind::double_value:
+                    return static_cast<T>(as_double());
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+            }
+        }
+
+        // A view of the characters of a string, valid as long as the tape is
+        template <class T>
+        typename std::enable_if<extension_traits::is_string_view<T>::value && detail::is_tape_text<T,char_type>::value,T>::type
+        as() const
+        {
+            if (!is_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+            }
+            auto sv = string_view();
+            return T(sv.data(), sv.size());
+        }
+
+        template <class T>
+        typename std::enable_if<extension_traits::is_string<T>::value && detail::is_tape_text<T,char_type>::value,T>::type
+        as() const
+        {
+            if (is_string())
+            {
+                auto sv = string_view();
+                return T(sv.data(), sv.size());
+            }
+            return as<basic_json<char_type>>().template as<T>();
+        }
+
+        template <class T>
+        typename std::enable_if<extension_traits::is_basic_json<T>::value,T>::type
+        as() const
+        {
+            json_decoder<T> decoder;
+            dump(decoder);
+            return decoder.get_result();
+        }
+
+        // Other types are converted through basic_json
+        template <class T>
+        typename std::enable_if<!extension_traits::is_basic_json<T>::value &&
+                                !std::is_same<T,bool>::value &&
+                                !extension_traits::is_integer<T>::value &&
+                                !std::is_floating_point<T>::value &&
+                                !detail::is_tape_text<T,char_type>::value,T>::type
+        as() const
+        {
+            return as<basic_json<char_type>>().template as<T>();
+        }
+
+        // Sends the events of the value to visitor
+        void dump(basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            dump(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            const uint64_t* words = tape_->words_.data();
+            const std::size_t last = next_index();
+            ser_context context;
+            std::size_t i = index_;
+            while (i < last && !ec)
+            {
+                const uint64_t w = words[i];
+                const semantic_tag tag = word::tag(w);
+                switch (word::kind(w))
+                {
+                    case kind::null_value:
+                        visitor.null_value(tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::true_value:
+                        visitor.bool_value(true, tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::false_value:
+                        visitor.bool_value(false, tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::small_int64_value:
+                        visitor.int64_value(word::signed_payload(w), tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::small_uint64_value:
+                        visitor.uint64_value(word::payload(w), tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::int64_value:
+                        visitor.int64_value(static_cast<int64_t>(words[i+1]), tag, context, ec);
+                        i += 2;
+                        break;
+                    case kind::uint64_value:
+                        visitor.uint64_value(words[i+1], tag, context, ec);
+                        i += 2;
+                        break;
+                    case kind::half_value:
+                        visitor.half_value(static_cast<uint16_t>(word::payload(w)), tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::double_value:
+                        visitor.double_value(basic_tape_value(tape_, i).as_double(), tag, context, ec);
+                        i += 2;
+                        break;
+                    case kind::short_key:
+                    case kind::key:
+                    {
+                        basic_tape_value key(tape_, i);
+                        visitor.key(key.string_view(), context, ec);
+                        i = key.next_index();
+                        break;
+                    }
+                    case kind::short_string_value:
+                    case kind::string_value:
+                    {
+                        basic_tape_value value(tape_, i);
+                        visitor.string_value(value.string_view(), tag, context, ec);
+                        i = value.next_index();
+                        break;
+                    }
+                    case kind::byte_string_value:
+                        visitor.byte_string_value(basic_tape_value(tape_, i).bytes_view(), tag, context, ec);
+                        i += 2;
+                        break;
+                    case kind::ext_byte_string_value:
+                        visitor.byte_string_value(basic_tape_value(tape_, i).bytes_view(), words[i+2], context, ec);
+                        i += 3;
+                        break;
+                    case kind::begin_object:
+                        visitor.begin_object(basic_tape_value(tape_, i).size(), tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::end_object:
+                        visitor.end_object(context, ec);
+                        i += 1;
+                        break;
+                    case kind::begin_array:
+                        visitor.begin_array(basic_tape_value(tape_, i).size(), tag, context, ec);
+                        i += 1;
+                        break;
+                    case kind::end_array:
+                        visitor.end_array(context, ec);
+                        i += 1;
+                        break;
+                }
+            }
+            if (!ec)
+            {
+                visitor.flush();
+            }
+        }
+
+        friend bool operator==(const basic_tape_value& lhs, const basic_tape_value& rhs)
+        {
+            return lhs.tape_ == rhs.tape_ && lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const basic_tape_value& lhs, const basic_tape_value& rhs)
+        {
+            return !(lhs == rhs);
+        }
+    private:
+        uint64_t at_word(std::size_t offset) const
+        {
+            return tape_->words_[index_ + offset];
+        }
+
+        // Index of the word just past this value
+        std::size_t next_index() const
+        {
+            switch (word::kind(at_word(0)))
+            {
+                case kind::null_value:
+                case kind::true_value:
+                case kind::false_value:
+                case kind::small_int64_value:
+                case kind::small_uint64_value:
+                case kind::half_value:
+                case kind::short_key:
+                case kind::short_string_value:
+                    return index_ + 1;
+                case kind::ext_byte_string_value:
+                    return index_ + 3;
+                case kind::begin_object:
+                case kind::begin_array:
+                    return word::payload(at_word(0));
+                default:
+                    return index_ + 2;
+            }
+        }
+
+        // Index of the value of the member with the given key, or 0
+        std::size_t find(const string_view_type& key) const
+        {
+            const std::size_t last = next_index() - 1;
+            std::size_t index = index_ + 1;
+            while (index < last)
+            {
+                basic_tape_value name(tape_, index);
+                if (name.string_view() == key)
+                {
+                    return name.next_index();
+                }
+                index = basic_tape_value(tape_, name.next_index()).next_index();
+            }
+            return 0;
+        }
+
+        int64_t int64_value() const
+        {
+            return word::kind(at_word(0)) == kind::small_int64_value ? word::signed_payload(at_word(0)) : static_cast<int64_t>(at_word(1));
+        }
+
+        uint64_t uint64_value() const
+        {
+            return word::kind(at_word(0)) == kind::small_uint64_value ? word::payload(at_word(0)) : at_word(1);
+        }
+
+        double as_double() const
+        {
+            if (word::kind(at_word(0)) == kind::half_value)
+            {
+                return binary::decode_half(static_cast<uint16_t>(word::payload(at_word(0))));
+            }
+            uint64_t bits = at_word(1);
+            double value;
+            std::memcpy(&value, &bits, sizeof(double));
+            return value;
+        }
+
+        string_view_type string_view() const
+        {
+            const uint64_t w = at_word(0);
+            if (word::kind(w) == kind::short_key || word::kind(w) == kind::short_string_value)
+            {
+                return string_view_type(tape_->strings_.data() + (word::payload(w) >> 16), word::payload(w) & 0xffff);
+            }
+            return string_view_type(tape_->strings_.data() + word::payload(w), static_cast<std::size_t>(at_word(1)));
+        }
+
+        byte_string_view bytes_view() const
+        {
+            return byte_string_view(tape_->bytes_.data() + word::payload(at_word(0)), static_cast<std::size_t>(at_word(1)));
+        }
+
+        static basic_tape_value make_item(const tape_type* tape, std::size_t index, basic_tape_value*)
+        {
+            return basic_tape_value(tape, index);
+        }
+
+        static key_value_type make_item(const tape_type* tape, std::size_t index, key_value_type*)
+        {
+            basic_tape_value name(tape, index);
+            return key_value_type(name.string_view(), basic_tape_value(tape, name.next_index()));
+        }
+
+        static std::size_t next_item(const tape_type* tape, std::size_t index, basic_tape_value*)
+        {
+            return basic_tape_value(tape, index).next_index();
+        }
+
+        // Past the key and the value
+        static std::size_t next_item(const tape_type* tape, std::size_t index, key_value_type*)
+        {
+            return basic_tape_value(tape, basic_tape_value(tape, index).next_index()).next_index();
+        }
+    };
+
+    template <class CharT>
+    class basic_tape_value<CharT>::key_value_type
+    {
+        friend class basic_tape_value;
+
+        string_view_type key_;
+        basic_tape_value value_;
+
+        key_value_type(const string_view_type& key, const basic_tape_value& value)
+            : key_(key), value_(value)
+        {
+        }
+    public:
+        string_view_type key() const
+        {
+            return key_;
+        }
+
+        const basic_tape_value& value() const
+        {
+            return value_;
+        }
+    };
+
+    // basic_json_tape
+
+    // A read-only document held in one array of 64 bit words, with the characters of all keys and
+    // strings in one arena and the bytes of all byte strings in another. Containers record the
+    // index just past their end, so passing over a value costs one step whatever its size.
+    // Built by basic_json_tape_decoder, or by parse.
+
+    template <class CharT>
+    class basic_json_tape
+    {
+        friend class basic_tape_value<CharT>;
+        friend class basic_json_tape_decoder<CharT>;
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        using const_reference = basic_tape_value<char_type>;
+        using object_iterator = typename const_reference::object_iterator;
+        using array_iterator = typename const_reference::array_iterator;
+    private:
+        std::vector<uint64_t> words_;
+        std::basic_string<char_type> strings_;
+        std::vector<uint8_t> bytes_;
+    public:
+        // A tape that holds null
+        basic_json_tape()
+            : words_(1, detail::tape_word::make(detail::tape_kind::null_value, semantic_tag::none, 0))
+        {
+        }
+
+        basic_json_tape(const basic_json_tape&) = default;
+        basic_json_tape(basic_json_tape&&) = default;
+        basic_json_tape& operator=(const basic_json_tape&) = default;
+        basic_json_tape& operator=(basic_json_tape&&) = default;
+
+        static basic_json_tape parse(const string_view_type& s,
+                                     const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>())
+        {
+            basic_json_tape_decoder<char_type> decoder;
+            basic_json_reader<char_type,string_source<char_type>> reader(s, decoder, options);
+            reader.read();
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(conv_errc::conversion_failed, reader.line(), reader.column()));
+            }
+            return decoder.get_result();
+        }
+
+        template <class Json>
+        static basic_json_tape from_json(const Json& value)
+        {
+            basic_json_tape_decoder<char_type> decoder;
+            value.dump(decoder);
+            return decoder.get_result();
+        }
+
+        const_reference root() const
+        {
+            return const_reference(this, 0);
+        }
+
+        // Bytes held by the tape and its arenas
+        std::size_t memory_size() const
+        {
+            return words_.capacity()*sizeof(uint64_t) + strings_.capacity()*sizeof(char_type) + bytes_.capacity();
+        }
+
+        json_type type() const
+        {
+            return root().type();
+        }
+
+        std::size_t size() const
+        {
+            return root().size();
+        }
+
+        bool empty() const
+        {
+            return root().empty();
+        }
+
+        bool contains(const string_view_type& key) const
+        {
+            return root().contains(key);
+        }
+
+        const_reference at(const string_view_type& key) const
+        {
+            return root().at(key);
+        }
+
+        const_reference operator[](const string_view_type& key) const
+        {
+            return root().at(key);
+        }
+
+        const_reference at(std::size_t i) const
+        {
+            return root().at(i);
+        }
+
+        const_reference operator[](std::size_t i) const
+        {
+            return root().at(i);
+        }
+
+        range<object_iterator,object_iterator> object_range() const
+        {
+            return root().object_range();
+        }
+
+        range<array_iterator,array_iterator> array_range() const
+        {
+            return root().array_range();
+        }
+
+        template <class T>
+        T as() const
+        {
+            return root().template as<T>();
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor) const
+        {
+            root().dump(visitor);
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            root().dump(visitor, ec);
+        }
+    };
+
+    // basic_json_tape_decoder
+
+    // Builds a basic_json_tape from the events of one value. Like json_decoder, it returns false
+    // when the value is complete, and starts a new tape with the next value.
+
+    template <class CharT>
+    class basic_json_tape_decoder : public basic_json_visitor<CharT>
+    {
+    public:
+        using typename basic_json_visitor<CharT>::char_type;
+        using typename basic_json_visitor<CharT>::string_view_type;
+    private:
+        using kind = detail::tape_kind;
+        using word = detail::tape_word;
+
+        basic_json_tape<char_type> result_;
+        std::vector<std::pair<std::size_t,std::size_t>> stack_; // begin word index and size of open containers
+        // Open addressing table of the short key payloads already in the arena plus one (zero marks
+        // an empty slot), so that a key repeated across the members of many objects is kept once
+        std::vector<uint64_t> keys_;
+        std::size_t key_count_;
+        bool is_valid_;
+    public:
+        basic_json_tape_decoder()
+            : key_count_(0), is_valid_(false)
+        {
+            result_.words_.clear();
+        }
+
+        void reset()
+        {
+            result_.words_.clear();
+            result_.strings_.clear();
+            result_.bytes_.clear();
+            stack_.clear();
+            keys_.clear();
+            key_count_ = 0;
+            is_valid_ = false;
+        }
+
+        bool is_valid() const
+        {
+            return is_valid_;
+        }
+
+        basic_json_tape<char_type> get_result()
+        {
+            JSONCONS_ASSERT(is_valid_);
+            result_.words_.shrink_to_fit();
+            result_.strings_.shrink_to_fit();
+            result_.bytes_.shrink_to_fit();
+            basic_json_tape<char_type> result(std::move(result_));
+            reset();
+            return result;
+        }
+    private:
+        // Called before the first word of a value
+        void begin_value()
+        {
+            if (stack_.empty())
+            {
+                if (is_valid_ || !result_.words_.empty())
+                {
+                    reset();
+                }
+            }
+            else if (word::kind(result_.words_[stack_.back().first]) == kind::begin_array)
+            {
+                ++stack_.back().second;
+            }
+        }
+
+        // Returns false if the value completes the tape
+        bool end_value()
+        {
+            if (stack_.empty())
+            {
+                is_valid_ = true;
+                return false;
+            }
+            return true;
+        }
+
+        bool push_scalar(kind k, semantic_tag tag, uint64_t value)
+        {
+            begin_value();
+            result_.words_.push_back(word::make(k, tag, 0));
+            result_.words_.push_back(value);
+            return end_value();
+        }
+
+        bool push_small_scalar(kind k, semantic_tag tag, uint64_t payload)
+        {
+            begin_value();
+            result_.words_.push_back(word::make(k, tag, payload & word::payload_mask));
+            return end_value();
+        }
+
+        void push_string(kind short_kind, kind long_kind, semantic_tag tag, const string_view_type& s)
+        {
+            const std::size_t offset = result_.strings_.size();
+            if (word::fits_short_string(offset, s.size()))
+            {
+                result_.words_.push_back(word::make(short_kind, tag, word::short_string_payload(offset, s.size())));
+            }
+            else
+            {
+                result_.words_.push_back(word::make(long_kind, tag, offset));
+                result_.words_.push_back(s.size());
+            }
+            result_.strings_.append(s.data(), s.size());
+        }
+
+        static std::size_t hash_key(const string_view_type& s)
+        {
+            return jsoncons::detail::fnv1a(s.data(), s.size());
+        }
+
+        void push_key(const string_view_type& name)
+        {
+            if (!word::fits_short_string(result_.strings_.size(), name.size()))
+            {
+                push_string(kind::short_key, kind::key, semantic_tag::none, name);
+                return;
+            }
+            if ((key_count_ + 1)*2 > keys_.size())
+            {
+                rehash_keys(keys_.empty() ? 64 : keys_.size()*2);
+            }
+            const std::size_t mask = keys_.size() - 1;
+            std::size_t slot = hash_key(name) & mask;
+            while (keys_[slot] != 0)
+            {
+                const uint64_t payload = keys_[slot] - 1;
+                if (string_view_type(result_.strings_.data() + (payload >> 16), payload & 0xffff) == name)
+                {
+                    result_.words_.push_back(word::make(kind::short_key, semantic_tag::none, payload));
+                    return;
+                }
+                slot = (slot + 1) & mask;
+            }
+            const uint64_t payload = word::short_string_payload(result_.strings_.size(), name.size());
+            keys_[slot] = payload + 1;
+            ++key_count_;
+            result_.words_.push_back(word::make(kind::short_key, semantic_tag::none, payload));
+            result_.strings_.append(name.data(), name.size());
+        }
+
+        void rehash_keys(std::size_t capacity)
+        {
+            std::vector<uint64_t> old(capacity, 0);
+            old.swap(keys_);
+            const std::size_t mask = keys_.size() - 1;
+            for (auto entry : old)
+            {
+                if (entry != 0)
+                {
+                    const uint64_t payload = entry - 1;
+                    std::size_t slot = hash_key(string_view_type(result_.strings_.data() + (payload >> 16), payload & 0xffff)) & mask;
+                    while (keys_[slot] != 0)
+                    {
+                        slot = (slot + 1) & mask;
+                    }
+                    keys_[slot] = entry;
+                }
+            }
+        }
+
+        bool begin_container(kind k, semantic_tag tag)
+        {
+            begin_value();
+            stack_.emplace_back(result_.words_.size(), 0);
+            result_.words_.push_back(word::make(k, tag, 0));
+            return true;
+        }
+
+        bool end_container(kind k)
+        {
+            JSONCONS_ASSERT(!stack_.empty());
+            const std::size_t begin = stack_.back().first;
+            const std::size_t size = stack_.back().second;
+            stack_.pop_back();
+            uint64_t& begin_word = result_.words_[begin];
+            begin_word = word::make(word::kind(begin_word), word::tag(begin_word), result_.words_.size() + 1);
+            result_.words_.push_back(word::make(k, semantic_tag::none, size));
+            return end_value();
+        }
+
+        void visit_flush() override
+        {
+        }
+
+        bool visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            return begin_container(kind::begin_object, tag);
+        }
+
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            return end_container(kind::end_object);
+        }
+
+        bool visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            return begin_container(kind::begin_array, tag);
+        }
+
+        bool visit_end_array(const ser_context&, std::error_code&) override
+        {
+            return end_container(kind::end_array);
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            ++stack_.back().second;
+            push_key(name);
+            return true;
+        }
+
+        bool visit_null(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            result_.words_.push_back(word::make(kind::null_value, tag, 0));
+            return end_value();
+        }
+
+        bool visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            result_.words_.push_back(word::make(value ? kind::true_value : kind::false_value, tag, 0));
+            return end_value();
+        }
+
+        bool visit_string(const string_view_type& s, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            push_string(kind::short_string_value, kind::string_value, tag, s);
+            return end_value();
+        }
+
+        bool visit_byte_string(const byte_string_view& b, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            result_.words_.push_back(word::make(kind::byte_string_value, tag, result_.bytes_.size()));
+            result_.words_.push_back(b.size());
+            result_.bytes_.insert(result_.bytes_.end(), b.begin(), b.end());
+            return end_value();
+        }
+
+        bool visit_byte_string(const byte_string_view& b, uint64_t ext_tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            result_.words_.push_back(word::make(kind::ext_byte_string_value, semantic_tag::ext, result_.bytes_.size()));
+            result_.words_.push_back(b.size());
+            result_.words_.push_back(ext_tag);
+            result_.bytes_.insert(result_.bytes_.end(), b.begin(), b.end());
+            return end_value();
+        }
+
+        bool visit_uint64(uint64_t value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            if (value <= word::payload_mask)
+            {
+                return push_small_scalar(kind::small_uint64_value, tag, value);
+            }
+            return push_scalar(kind::uint64_value, tag, value);
+        }
+
+        bool visit_int64(int64_t value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            if (word::fits_signed_payload(value))
+            {
+                return push_small_scalar(kind::small_int64_value, tag, static_cast<uint64_t>(value));
+            }
+            return push_scalar(kind::int64_value, tag, static_cast<uint64_t>(value));
+        }
+
+        bool visit_half(uint16_t value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            return push_small_scalar(kind::half_value, tag, value);
+        }
+
+        bool visit_double(double value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(double));
+            return push_scalar(kind::double_value, tag, bits);
+        }
+    };
+
+    using json_tape = basic_json_tape<char>;
+    using wjson_tape = basic_json_tape<wchar_t>;
+
+    using json_tape_decoder = basic_json_tape_decoder<char>;
+    using wjson_tape_decoder = basic_json_tape_decoder<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
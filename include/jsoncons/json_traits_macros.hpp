@@ -7,16 +7,22 @@
 #ifndef JSONCONS_JSON_TRAITS_MACROS_HPP
 #define JSONCONS_JSON_TRAITS_MACROS_HPP
 
-#include <algorithm> // std::swap
+#include <algorithm> // std::swap, std::stable_sort
+#include <array>
 #include <iterator> // std::iterator_traits, std::input_iterator_tag
 #include <jsoncons/config/jsoncons_config.hpp> // JSONCONS_EXPAND, JSONCONS_QUOTE
 #include <jsoncons/extension_traits.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/detail/fnv1a.hpp>
 #include <limits> // std::numeric_limits
+#include <cstdint>
+#include <vector>
 #include <string>
 #include <type_traits> // std::enable_if
 #include <utility>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/encode_traits.hpp>
 
 namespace jsoncons
 {
@@ -46,6 +52,118 @@ namespace jsoncons
     struct json_traits_macro_names
     {};
 
+    // Maps the member names of a macro-declared type to their position in the declaration.
+    // The table is built once per type, trying hash seeds until each name has a slot of its own,
+    // so that finding a key takes one hash and one comparison. If no such seed turns up, names 
+    // that collide fall back to linear probing.
+    template <class CharT, std::size_t NumParams>
+    class json_traits_member_index
+    {
+        static_assert(NumParams < 255, "Too many members");
+
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        static constexpr uint8_t empty_slot = 0xff;
+        static constexpr uint32_t max_seed = 256;
+
+        const string_view_type* names_;
+        std::vector<uint8_t> slots_;
+        int shift_;
+        uint32_t seed_;
+        bool perfect_;
+    public:
+        explicit json_traits_member_index(const string_view_type (&names)[NumParams])
+            : names_(names), shift_(32), seed_(0), perfect_(false)
+        {
+            int bits = 2;
+            while ((std::size_t(1) << bits) < 2*NumParams)
+            {
+                ++bits;
+            }
+            // Each doubling of the table makes a collision free seed likelier
+            for (int tries = 0; tries < 3 && !perfect_; ++tries, ++bits)
+            {
+                slots_.resize(std::size_t(1) << bits);
+                shift_ = 32 - bits;
+                for (uint32_t seed = 0; seed < max_seed && !perfect_; ++seed)
+                {
+                    seed_ = seed;
+                    perfect_ = try_place();
+                }
+            }
+            if (!perfect_)
+            {
+                seed_ = 0;
+                place();
+            }
+        }
+
+        std::size_t find(const string_view_type& key) const
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t slot = hash(key);
+            if (perfect_)
+            {
+                const uint8_t index = slots_[slot];
+                return index != empty_slot && names_[index] == key ? index : NumParams;
+            }
+            while (slots_[slot] != empty_slot)
+            {
+                if (names_[slots_[slot]] == key)
+                {
+                    return slots_[slot];
+                }
+                slot = (slot + 1) & mask;
+            }
+            return NumParams;
+        }
+    private:
+        std::size_t hash(const string_view_type& key) const
+        {
+            // FNV-1a, then a multiplicative step to take the top bits
+            const uint32_t h = jsoncons::detail::fnv1a_32(key.data(), key.size(), 2166136261u ^ seed_);
+            return static_cast<std::size_t>((h * 2654435769u) >> shift_);
+        }
+
+        bool try_place()
+        {
+            std::fill(slots_.begin(), slots_.end(), empty_slot);
+            for (std::size_t i = 0; i < NumParams; ++i)
+            {
+                const std::size_t slot = hash(names_[i]);
+                if (slots_[slot] != empty_slot)
+                {
+                    return false;
+                }
+                slots_[slot] = static_cast<uint8_t>(i);
+            }
+            return true;
+        }
+
+        void place()
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::fill(slots_.begin(), slots_.end(), empty_slot);
+            for (std::size_t i = 0; i < NumParams; ++i)
+            {
+                std::size_t slot = hash(names_[i]);
+                while (slots_[slot] != empty_slot)
+                {
+                    slot = (slot + 1) & mask;
+                }
+                slots_[slot] = static_cast<uint8_t>(i);
+            }
+        }
+    };
+#if __cplusplus >= 201703L
+// not needed for C++17
+#else
+    template <class CharT, std::size_t NumParams>
+    constexpr uint8_t json_traits_member_index<CharT,NumParams>::empty_slot;
+    template <class CharT, std::size_t NumParams>
+    constexpr uint32_t json_traits_member_index<CharT,NumParams>::max_seed;
+#endif
+
     template <class Json>
     struct json_traits_helper
     {
@@ -90,6 +208,225 @@ namespace jsoncons
         { 
             j.try_emplace(key, val); 
         } 
+
+        template <class CharT, class TempAllocator, class OutputType>
+        static void decode_udt_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>&, const OutputType&, std::error_code& ec)
+        {
+            skip_value(cursor, ec);
+        }
+        template <class CharT, class TempAllocator, class OutputType>
+        static void decode_udt_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, OutputType& val, std::error_code& ec)
+        {
+            val = decode_traits<OutputType,CharT>::decode(cursor, decoder, ec);
+            if (!ec)
+            {
+                cursor.next(ec);
+            }
+        }
+        template <class OutputType, class U>
+        static void assign_udt_member(const OutputType&, U&&)
+        {
+        }
+        template <class OutputType, class U>
+        static void assign_udt_member(OutputType& val, U&& from)
+        {
+            val = std::forward<U>(from);
+        }
+
+        // Reads the value at the cursor's current event, calling decode_member(index)
+        // with the cursor on the value of each key that index_of maps below NumParams.
+        // decode_member leaves the cursor past that value. Other values are skipped, as are
+        // repeated keys, the first occurrence wins as with as<T>(). Returns false if the value
+        // is not an object, if one of the first NumMandatoryParams is missing, if decode_member
+        // returns false, or if a member does not convert to its type as reported by a conv_errc.
+        // The caller then throws conv_error, as as<T>() does. The whole value is consumed in
+        // these cases, except after a container member that failed partway. A conv_error thrown
+        // by a nested type propagates, the cursor may then be anywhere inside the member's value.
+        // ec is only set for errors reported by the cursor.
+        template <std::size_t NumParams, std::size_t NumMandatoryParams, class CharT, class IndexOf, class DecodeMember>
+        static bool decode_udt_members(basic_staj_cursor<CharT>& cursor, IndexOf index_of, DecodeMember decode_member, std::error_code& ec)
+        {
+            if (cursor.current().event_type() != staj_event_type::begin_object)
+            {
+                consume_value(cursor, ec);
+                return false;
+            }
+            bool found[NumParams] = {};
+            bool valid = true;
+            cursor.next(ec);
+            while (!ec && cursor.current().event_type() != staj_event_type::end_object)
+            {
+                if (cursor.current().event_type() != staj_event_type::key)
+                {
+                    ec = json_errc::expected_key;
+                    return false;
+                }
+                // The key is only valid until the cursor moves on
+                const std::size_t index = index_of(cursor.current().template get<jsoncons::basic_string_view<CharT>>(ec));
+                if (ec) return false;
+                cursor.next(ec);
+                if (ec) return false;
+                if (index < NumParams && !found[index])
+                {
+                    found[index] = true;
+                    const staj_event_type event_type = cursor.current().event_type();
+                    bool decoded = decode_member(index);
+                    if (ec && ec.category() == conv_error_category())
+                    {
+                        ec = std::error_code();
+                        decoded = false;
+                        if (event_type == staj_event_type::begin_object || event_type == staj_event_type::begin_array)
+                        {
+                            return false;
+                        }
+                        cursor.next(ec);
+                    }
+                    if (!decoded)
+                    {
+                        valid = false;
+                    }
+                }
+                else
+                {
+                    skip_value(cursor, ec);
+                }
+            }
+            if (ec) return false;
+            for (std::size_t i = 0; i < NumMandatoryParams; ++i)
+            {
+                if (!found[i])
+                {
+                    return false;
+                }
+            }
+            return valid;
+        }
+
+        template <class U> 
+        static bool is_optional_udt_member_present(const std::shared_ptr<U>& val) 
+        { 
+            return val ? true : false; 
+        } 
+        template <class U> 
+        static bool is_optional_udt_member_present(const std::unique_ptr<U>& val) 
+        { 
+            return val ? true : false; 
+        } 
+        template <class U> 
+        static bool is_optional_udt_member_present(const jsoncons::optional<U>& val) 
+        { 
+            return val.has_value(); 
+        } 
+        template <class U> 
+        static bool is_optional_udt_member_present(const U&) 
+        { 
+            return true; 
+        } 
+
+        template <class CharT, class U>
+        static void encode_udt_member(const U& val, basic_json_visitor<CharT>& encoder, const Json& proto, std::error_code& ec)
+        {
+            encode_traits<U,CharT>::encode(val, encoder, proto, ec);
+        }
+
+        template <class Object>
+        using key_order_of_t = typename Object::key_order_type;
+
+        using key_order_type = typename extension_traits::detected_or_t<void,key_order_of_t,typename Json::object>;
+
+        // Writes the members of aval to the visitor as the events that dumping 
+        // json_type_traits<Json,T>::to_json(aval) would produce, without building the object.
+        // names holds the member names in declaration order, is_present(index) tells whether 
+        // an optional member is written, and encode_member(index) writes the member's value.
+        template <class T, class CharT, std::size_t NumParams, class IsPresent, class EncodeMember>
+        static void encode_udt_members(const T& aval, 
+                                       const jsoncons::basic_string_view<CharT> (&names)[NumParams],
+                                       IsPresent is_present, 
+                                       EncodeMember encode_member,
+                                       basic_json_visitor<CharT>& encoder,
+                                       const Json& proto,
+                                       std::error_code& ec)
+        {
+            encode_udt_members(std::integral_constant<bool,std::is_same<key_order_type,sort_key_order>::value || 
+                                                           std::is_same<key_order_type,preserve_key_order>::value>(),
+                               aval, names, is_present, encode_member, encoder, proto, ec);
+        }
+
+        template <class T, class CharT, std::size_t NumParams, class IsPresent, class EncodeMember>
+        static void encode_udt_members(std::true_type,
+                                       const T&, 
+                                       const jsoncons::basic_string_view<CharT> (&names)[NumParams],
+                                       IsPresent is_present, 
+                                       EncodeMember encode_member,
+                                       basic_json_visitor<CharT>& encoder,
+                                       const Json&,
+                                       std::error_code& ec)
+        {
+            // Names are fixed for each T, so the order is only worked out once
+            static const std::array<std::size_t,NumParams> order = udt_member_order(key_order_type(), names);
+
+            bool present[NumParams];
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < NumParams; ++i)
+            {
+                present[i] = is_present(i);
+                if (present[i])
+                {
+                    ++count;
+                }
+            }
+            encoder.begin_object(count, semantic_tag::none, ser_context(), ec);
+            if (ec) return;
+            for (std::size_t i = 0; i < NumParams; ++i)
+            {
+                const std::size_t index = order[i];
+                if (present[index])
+                {
+                    encoder.key(names[index], ser_context(), ec);
+                    if (ec) return;
+                    encode_member(index);
+                    if (ec) return;
+                }
+            }
+            encoder.end_object(ser_context(), ec);
+        }
+
+        // Object types that don't declare a key order go through to_json
+        template <class T, class CharT, std::size_t NumParams, class IsPresent, class EncodeMember>
+        static void encode_udt_members(std::false_type,
+                                       const T& aval, 
+                                       const jsoncons::basic_string_view<CharT> (&)[NumParams],
+                                       IsPresent, 
+                                       EncodeMember,
+                                       basic_json_visitor<CharT>& encoder,
+                                       const Json& proto,
+                                       std::error_code& ec)
+        {
+            auto j = json_type_traits<Json,T>::to_json(aval, proto.get_allocator());
+            j.dump(encoder, ec);
+        }
+
+        template <class CharT, std::size_t NumParams>
+        static std::array<std::size_t,NumParams> udt_member_order(preserve_key_order, 
+                                                                  const jsoncons::basic_string_view<CharT> (&)[NumParams])
+        {
+            std::array<std::size_t,NumParams> order;
+            for (std::size_t i = 0; i < NumParams; ++i)
+            {
+                order[i] = i;
+            }
+            return order;
+        }
+
+        template <class CharT, std::size_t NumParams>
+        static std::array<std::size_t,NumParams> udt_member_order(sort_key_order, 
+                                                                  const jsoncons::basic_string_view<CharT> (&names)[NumParams])
+        {
+            std::array<std::size_t,NumParams> order = udt_member_order(preserve_key_order(), names);
+            std::stable_sort(order.begin(), order.end(),
+                             [&](std::size_t a, std::size_t b) -> bool {return names[a].compare(names[b]) < 0;});
+            return order;
+        }
     };
 }
 
@@ -185,7 +522,11 @@ namespace jsoncons
 
 #define JSONCONS_TYPE_TRAITS_FRIEND \
     template <class JSON,class T,class Enable> \
-    friend struct jsoncons::json_type_traits;
+    friend struct jsoncons::json_type_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::decode_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::encode_traits;
 
 #define JSONCONS_EXPAND_CALL2(Call, Expr, Id) JSONCONS_EXPAND(Call(Expr, Id))
 
@@ -279,6 +620,21 @@ namespace jsoncons
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
     ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member);
 
+#define JSONCONS_MEMBER_KEY(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_KEY_LAST(Prefix, P2, P3, Member, Count),
+#define JSONCONS_MEMBER_KEY_LAST(Prefix, P2, P3, Member, Count) json_traits_macro_names<char_type,value_type>::Member##_str(char_type{})
+
+#define JSONCONS_MEMBER_DECODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count) \
+    case num_params-Count: json_traits_helper<Json>::decode_udt_member(cursor, decoder, aval.Member, ec); break;
+
+#define JSONCONS_MEMBER_IS_PRESENT(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_IS_PRESENT_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_IS_PRESENT_LAST(Prefix, P2, P3, Member, Count) \
+    case num_params-Count: return (num_params-Count) < num_mandatory_params2 || json_traits_helper<Json>::is_optional_udt_member_present(aval.Member);
+
+#define JSONCONS_MEMBER_ENCODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count) \
+    case num_params-Count: json_traits_helper<Json>::encode_udt_member(aval.Member, encoder, proto, ec); break;
+
 #define JSONCONS_MEMBER_TRAITS_BASE(AsT,ToJ,NumTemplateParams,ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -317,6 +673,75 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<ChT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_KEY, ,,, __VA_ARGS__) }; \
+            static const json_traits_member_index<ChT,num_params> member_index(names); \
+            value_type aval{}; \
+            bool converted = json_traits_helper<Json>::template decode_udt_members<num_params,num_mandatory_params1>(cursor, \
+                [](const string_view_type& key) -> std::size_t \
+                { \
+                    return member_index.find(key); \
+                }, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_DECODE, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, ec); \
+            if (!converted && !ec) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        template <class Json> \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<ChT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_KEY, ,,, __VA_ARGS__) }; \
+            json_traits_helper<Json>::encode_udt_members(aval, names, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_IS_PRESENT, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, \
+                [&](std::size_t index) \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_ENCODE, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                }, encoder, proto, ec); \
+        } \
+    }; \
 } \
   /**/
 
@@ -396,6 +821,52 @@ else \
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_5(Member, Name, Mode, Match, Into) JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, )
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, From) ajson.try_emplace(Name, Into(aval.Member));
 
+#define JSONCONS_MEMBER_NAME_STR(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_STR_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_MEMBER_NAME_STR_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_KEY_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_MEMBER_NAME_KEY_2(Member, Name) Name
+#define JSONCONS_MEMBER_NAME_KEY_3(Member, Name, Mode) Name
+#define JSONCONS_MEMBER_NAME_KEY_4(Member, Name, Mode, Match) Name
+#define JSONCONS_MEMBER_NAME_KEY_5(Member, Name, Mode, Match, Into) Name
+#define JSONCONS_MEMBER_NAME_KEY_6(Member, Name, Mode, Match, Into, From) Name
+
+#define JSONCONS_MEMBER_NAME_DECODE(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count) \
+    case num_params-Count: JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_DECODE_,JSONCONS_NARGS Seq) Seq) break;
+#define JSONCONS_MEMBER_NAME_DECODE_2(Member, Name) \
+    json_traits_helper<Json>::decode_udt_member(cursor, decoder, aval.Member, ec);
+#define JSONCONS_MEMBER_NAME_DECODE_3(Member, Name, Mode) \
+    { \
+        bool decoded = false; \
+        Mode(json_traits_helper<Json>::decode_udt_member(cursor, decoder, aval.Member, ec); decoded = true;) \
+        if (!decoded) skip_value(cursor, ec); \
+    }
+#define JSONCONS_MEMBER_NAME_DECODE_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, , )
+#define JSONCONS_MEMBER_NAME_DECODE_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, Into, )
+#define JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, Into, From) \
+    { \
+        auto val = decode_traits<typename std::decay<decltype(Into(aval.Member))>::type,char_type>::decode(cursor, decoder, ec); \
+        if (ec) break; \
+        cursor.next(ec); \
+        if (ec) break; \
+        if (!Match(val)) return false; \
+        Mode(json_traits_helper<Json>::assign_udt_member(aval.Member, From(std::move(val)));) \
+    }
+
+#define JSONCONS_MEMBER_NAME_VALUE_2(Member, Name) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_3(Member, Name, Mode) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_4(Member, Name, Mode, Match) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_5(Member, Name, Mode, Match, Into) Into(aval.Member)
+#define JSONCONS_MEMBER_NAME_VALUE_6(Member, Name, Mode, Match, Into, From) Into(aval.Member)
+
+#define JSONCONS_MEMBER_NAME_IS_PRESENT(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_IS_PRESENT_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_IS_PRESENT_LAST(P1, P2, P3, Seq, Count) \
+    case num_params-Count: return (num_params-Count) < num_mandatory_params2 || \
+        json_traits_helper<Json>::is_optional_udt_member_present(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq));
+
+#define JSONCONS_MEMBER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) \
+    case num_params-Count: json_traits_helper<Json>::encode_udt_member(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec); break;
+
 #define JSONCONS_MEMBER_NAME_TRAITS_BASE(AsT,ToJ, NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -429,6 +900,75 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<ChT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_STR,,,, __VA_ARGS__) }; \
+            static const json_traits_member_index<ChT,num_params> member_index(names); \
+            value_type aval{}; \
+            bool converted = json_traits_helper<Json>::template decode_udt_members<num_params,num_mandatory_params1>(cursor, \
+                [](const string_view_type& key) -> std::size_t \
+                { \
+                    return member_index.find(key); \
+                }, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_DECODE,,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, ec); \
+            if (!converted && !ec) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        template <class Json> \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<ChT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_STR,,,, __VA_ARGS__) }; \
+            json_traits_helper<Json>::encode_udt_members(aval, names, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_IS_PRESENT,,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, \
+                [&](std::size_t index) \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_ENCODE,,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                }, encoder, proto, ec); \
+        } \
+    }; \
 } \
   /**/
 
@@ -459,6 +999,25 @@ namespace jsoncons \
 #define JSONCONS_CTOR_GETTER_AS(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count),
 #define JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count) ((num_params-Count) < num_mandatory_params2) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype((std::declval<value_type*>())->Getter())>::type>() : (ajson.contains(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{})) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype((std::declval<value_type*>())->Getter())>::type>() : typename std::decay<decltype((std::declval<value_type*>())->Getter())>::type())
 
+#define JSONCONS_CTOR_GETTER_DECODE_LOCAL(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_DECODE_LOCAL_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_DECODE_LOCAL_LAST(Prefix, P2, P3, Getter, Count) \
+    typename std::decay<decltype((std::declval<value_type*>())->Getter())>::type Getter##_value{};
+
+#define JSONCONS_CTOR_GETTER_DECODE(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_DECODE_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_DECODE_LAST(Prefix, P2, P3, Getter, Count) \
+    case num_params-Count: json_traits_helper<Json>::decode_udt_member(cursor, decoder, Getter##_value, ec); break;
+
+#define JSONCONS_CTOR_GETTER_DECODE_ARG(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_DECODE_ARG_LAST(Prefix, P2, P3, Getter, Count),
+#define JSONCONS_CTOR_GETTER_DECODE_ARG_LAST(Prefix, P2, P3, Getter, Count) std::move(Getter##_value)
+
+#define JSONCONS_CTOR_GETTER_IS_PRESENT(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_IS_PRESENT_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_IS_PRESENT_LAST(Prefix, P2, P3, Getter, Count) \
+    case num_params-Count: return (num_params-Count) < num_mandatory_params2 || json_traits_helper<Json>::is_optional_udt_member_present(aval.Getter());
+
+#define JSONCONS_CTOR_GETTER_ENCODE(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count) \
+    case num_params-Count: json_traits_helper<Json>::encode_udt_member(aval.Getter(), encoder, proto, ec); break;
+
 #define JSONCONS_CTOR_GETTER_TO_JSON(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_TO_JSON_LAST(Prefix, P2, P3, Getter, Count)
 
 #define JSONCONS_CTOR_GETTER_TO_JSON_LAST(Prefix, P2, P3, Getter, Count) \
@@ -505,6 +1064,80 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<ChT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_KEY, ,,, __VA_ARGS__) }; \
+            static const json_traits_member_index<ChT,num_params> member_index(names); \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_DECODE_LOCAL, ,,, __VA_ARGS__) \
+            bool converted = json_traits_helper<Json>::template decode_udt_members<num_params,num_mandatory_params1>(cursor, \
+                [](const string_view_type& key) -> std::size_t \
+                { \
+                    return member_index.find(key); \
+                }, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_DECODE, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, ec); \
+            /* There is no value to return with ec, so a cursor error is thrown, as decode_json would */ \
+            if (ec) \
+            { \
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column())); \
+            } \
+            if (!converted) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            return value_type ( JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_DECODE_ARG, ,,, __VA_ARGS__) ); \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using string_view_type = jsoncons::basic_string_view<ChT>; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        template <class Json> \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<ChT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            static const string_view_type names[] = { JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_KEY, ,,, __VA_ARGS__) }; \
+            json_traits_helper<Json>::encode_udt_members(aval, names, \
+                [&](std::size_t index) -> bool \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_IS_PRESENT, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                    return true; \
+                }, \
+                [&](std::size_t index) \
+                { \
+                    switch (index) \
+                    { \
+                        JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_ENCODE, ,,, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                }, encoder, proto, ec); \
+        } \
+    }; \
 } \
   /**/
  
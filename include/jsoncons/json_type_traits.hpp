@@ -131,6 +131,59 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
         !is_json_type_traits_unspecialized<Json,typename std::iterator_traits<typename T::iterator>::value_type>::value
     >::type> : std::true_type {};
 
+    // array_element_reader
+
+    // Reads the elements of an array by index. The elements of a typed array are packed, they
+    // are read by value into a scratch value, so that a conversion does not build Json elements
+    // for the whole array.
+    template <class Json>
+    class array_element_reader
+    {
+        const Json& j_;
+        const typename Json::typed_array* typed_;
+        Json scratch_;
+    public:
+        explicit array_element_reader(const Json& j)
+            : j_(j), 
+              typed_(j.storage_kind() == json_storage_kind::typed_array_value ? std::addressof(j.template cast<typename Json::typed_array_storage>().value()) : nullptr)
+        {
+        }
+
+        std::size_t size() const
+        {
+            return j_.size();
+        }
+
+        const Json& operator[](std::size_t i)
+        {
+            if (typed_ == nullptr)
+            {
+                return j_[i];
+            }
+            scratch_ = typed_->element(i);
+            return scratch_;
+        }
+    };
+
+    // Whether j is an array of elements that are all T
+    template <class T, class Json>
+    bool is_array_of(const Json& j) noexcept
+    {
+        if (!j.is_array())
+        {
+            return false;
+        }
+        array_element_reader<Json> elements(j);
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            if (!elements[i].template is<T>())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
 } // namespace detail
 
     // is_json_type_traits_specialized
@@ -528,19 +581,7 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (auto e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return jsoncons::detail::is_array_of<value_type>(j);
         }
 
         // array back insertable non-byte container
@@ -552,10 +593,11 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             if (j.is_array())
             {
                 T result;
-                visit_reserve_(typename std::integral_constant<bool, extension_traits::has_reserve<T>::value>::type(),result,j.size());
-                for (const auto& item : j.array_range())
+                jsoncons::detail::array_element_reader<Json> elements(j);
+                visit_reserve_(typename std::integral_constant<bool, extension_traits::has_reserve<T>::value>::type(),result,elements.size());
+                for (std::size_t i = 0; i < elements.size(); ++i)
                 {
-                    result.push_back(item.template as<value_type>());
+                    result.push_back(elements[i].template as<value_type>());
                 }
 
                 return result;
@@ -576,10 +618,11 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             if (j.is_array())
             {
                 T result;
-                visit_reserve_(typename std::integral_constant<bool, extension_traits::has_reserve<T>::value>::type(),result,j.size());
-                for (const auto& item : j.array_range())
+                jsoncons::detail::array_element_reader<Json> elements(j);
+                visit_reserve_(typename std::integral_constant<bool, extension_traits::has_reserve<T>::value>::type(),result,elements.size());
+                for (std::size_t i = 0; i < elements.size(); ++i)
                 {
-                    result.push_back(item.template as<value_type>());
+                    result.push_back(elements[i].template as<value_type>());
                 }
 
                 return result;
@@ -682,19 +725,7 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (auto e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return jsoncons::detail::is_array_of<value_type>(j);
         }
 
         static T as(const Json& j)
@@ -702,9 +733,10 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             if (j.is_array())
             {
                 T result;
-                for (const auto& item : j.array_range())
+                jsoncons::detail::array_element_reader<Json> elements(j);
+                for (std::size_t i = 0; i < elements.size(); ++i)
                 {
-                    result.insert(item.template as<value_type>());
+                    result.insert(elements[i].template as<value_type>());
                 }
 
                 return result;
@@ -759,19 +791,7 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (auto e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return jsoncons::detail::is_array_of<value_type>(j);
         }
 
         static T as(const Json& j)
@@ -779,12 +799,10 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             if (j.is_array())
             {
                 T result;
-
-                auto it = j.array_range().rbegin();
-                auto end = j.array_range().rend();
-                for (; it != end; ++it)
+                jsoncons::detail::array_element_reader<Json> elements(j);
+                for (std::size_t i = elements.size(); i-- > 0;)
                 {
-                    result.push_front((*it).template as<value_type>());
+                    result.push_front(elements[i].template as<value_type>());
                 }
 
                 return result;
@@ -835,19 +853,7 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array() && j.size() == N;
-            if (result)
-            {
-                for (auto e : j.array_range())
-                {
-                    if (!e.template is<value_type>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return j.is_array() && j.size() == N && jsoncons::detail::is_array_of<value_type>(j);
         }
 
         static std::array<E, N> as(const Json& j)
@@ -857,9 +863,10 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             {
                 JSONCONS_THROW(conv_error(conv_errc::not_array));
             }
+            jsoncons::detail::array_element_reader<Json> elements(j);
             for (std::size_t i = 0; i < N; i++)
             {
-                buff[i] = j[i].template as<E>();
+                buff[i] = elements[i].template as<E>();
             }
             return buff;
         }
@@ -1040,11 +1047,11 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
             using element_type = typename std::tuple_element<Size-Pos, Tuple>::type;
             using next = json_tuple_helper<Pos-1, Size, Json, Tuple>;
             
-            static bool is(const Json& j) noexcept
+            static bool is(jsoncons::detail::array_element_reader<Json>& elements) noexcept
             {
-                if (j[Size-Pos].template is<element_type>())
+                if (elements[Size-Pos].template is<element_type>())
                 {
-                    return next::is(j);
+                    return next::is(elements);
                 }
                 else
                 {
@@ -1052,10 +1059,10 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
                 }
             }
 
-            static void as(Tuple& tuple, const Json& j)
+            static void as(Tuple& tuple, jsoncons::detail::array_element_reader<Json>& elements)
             {
-                std::get<Size-Pos>(tuple) = j[Size-Pos].template as<element_type>();
-                next::as(tuple, j);
+                std::get<Size-Pos>(tuple) = elements[Size-Pos].template as<element_type>();
+                next::as(tuple, elements);
             }
 
             static void to_json(const Tuple& tuple, Json& j)
@@ -1068,12 +1075,12 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
         template<size_t Size, class Json, class Tuple>
         struct json_tuple_helper<0, Size, Json, Tuple>
         {
-            static bool is(const Json&) noexcept
+            static bool is(jsoncons::detail::array_element_reader<Json>&) noexcept
             {
                 return true;
             }
 
-            static void as(Tuple&, const Json&)
+            static void as(Tuple&, jsoncons::detail::array_element_reader<Json>&)
             {
             }
 
@@ -1094,13 +1101,15 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            return helper::is(j);
+            jsoncons::detail::array_element_reader<Json> elements(j);
+            return helper::is(elements);
         }
         
         static std::tuple<E...> as(const Json& j)
         {
             std::tuple<E...> buff;
-            helper::as(buff, j);
+            jsoncons::detail::array_element_reader<Json> elements(j);
+            helper::as(buff, elements);
             return buff;
         }
          
@@ -1345,29 +1354,18 @@ has_can_convert = extension_traits::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            bool result = j.is_array();
-            if (result)
-            {
-                for (auto e : j.array_range())
-                {
-                    if (!e.template is<T>())
-                    {
-                        result = false;
-                        break;
-                    }
-                }
-            }
-            return result;
+            return jsoncons::detail::is_array_of<T>(j);
         }
         
         static std::valarray<T> as(const Json& j)
         {
             if (j.is_array())
             {
-                std::valarray<T> v(j.size());
-                for (std::size_t i = 0; i < j.size(); ++i)
+                jsoncons::detail::array_element_reader<Json> elements(j);
+                std::valarray<T> v(elements.size());
+                for (std::size_t i = 0; i < elements.size(); ++i)
                 {
-                    v[i] = j[i].template as<T>();
+                    v[i] = elements[i].template as<T>();
                 }
                 return v;
             }
@@ -0,0 +1,234 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_TYPED_ARRAY_HPP
+#define JSONCONS_JSON_TYPED_ARRAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <memory> // std::allocator
+#include <system_error>
+#include <type_traits> // std::enable_if
+#include <vector>
+#include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/tag_type.hpp>
+#include <jsoncons/typed_array_view.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // The typed_array_type of a typed array element
+    template <class T>
+    struct typed_array_type_of {};
+
+    template <>
+    struct typed_array_type_of<uint8_t> : std::integral_constant<typed_array_type,typed_array_type::uint8_value> {};
+    template <>
+    struct typed_array_type_of<uint16_t> : std::integral_constant<typed_array_type,typed_array_type::uint16_value> {};
+    template <>
+    struct typed_array_type_of<uint32_t> : std::integral_constant<typed_array_type,typed_array_type::uint32_value> {};
+    template <>
+    struct typed_array_type_of<uint64_t> : std::integral_constant<typed_array_type,typed_array_type::uint64_value> {};
+    template <>
+    struct typed_array_type_of<int8_t> : std::integral_constant<typed_array_type,typed_array_type::int8_value> {};
+    template <>
+    struct typed_array_type_of<int16_t> : std::integral_constant<typed_array_type,typed_array_type::int16_value> {};
+    template <>
+    struct typed_array_type_of<int32_t> : std::integral_constant<typed_array_type,typed_array_type::int32_value> {};
+    template <>
+    struct typed_array_type_of<int64_t> : std::integral_constant<typed_array_type,typed_array_type::int64_value> {};
+    template <>
+    struct typed_array_type_of<float> : std::integral_constant<typed_array_type,typed_array_type::float_value> {};
+    template <>
+    struct typed_array_type_of<double> : std::integral_constant<typed_array_type,typed_array_type::double_value> {};
+
+    template <class T,class Enable=void>
+    struct is_typed_array_element : std::false_type {};
+
+    template <class T>
+    struct is_typed_array_element<T,typename std::enable_if<sizeof(typed_array_type_of<T>::value) != 0>::type> : std::true_type {};
+
+} // namespace detail
+
+    // json_typed_array
+
+    // The elements of a homogeneous numeric array, packed in one buffer as they arrive in a typed
+    // array event. Elements are read by value. There are no Json elements to refer to, to_array()
+    // makes a regular array of them.
+
+    template <class Json>
+    class json_typed_array : public allocator_holder<typename Json::allocator_type>
+    {
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using char_type = typename Json::char_type;
+        using array = typename Json::array;
+    private:
+        using word_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t>;
+
+        typed_array_type type_;
+        std::size_t size_;
+        // Whole words, so that elements of every type are aligned
+        std::vector<uint64_t,word_allocator_type> words_;
+    public:
+        using allocator_holder<allocator_type>::get_allocator;
+
+        template <class T>
+        json_typed_array(const jsoncons::span<const T>& data, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              type_(detail::typed_array_type_of<T>::value), size_(data.size()),
+              words_((data.size()*sizeof(T) + sizeof(uint64_t) - 1)/sizeof(uint64_t), 0, word_allocator_type(alloc))
+        {
+            if (size_ > 0)
+            {
+                std::memcpy(words_.data(), data.data(), data.size()*sizeof(T));
+            }
+        }
+
+        json_typed_array(half_arg_t, const jsoncons::span<const uint16_t>& data, const allocator_type& alloc = allocator_type())
+            : json_typed_array(data, alloc)
+        {
+            type_ = typed_array_type::half_value;
+        }
+
+        json_typed_array(const json_typed_array& other)
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              type_(other.type_), size_(other.size_), words_(other.words_)
+        {
+        }
+
+        json_typed_array(const json_typed_array& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              type_(other.type_), size_(other.size_), words_(other.words_, word_allocator_type(alloc))
+        {
+        }
+
+        json_typed_array(json_typed_array&& other) noexcept
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              type_(other.type_), size_(other.size_), words_(std::move(other.words_))
+        {
+        }
+
+        json_typed_array(json_typed_array&& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              type_(other.type_), size_(other.size_), words_(std::move(other.words_), word_allocator_type(alloc))
+        {
+        }
+
+        json_typed_array& operator=(const json_typed_array&) = delete;
+
+        typed_array_type type() const
+        {
+            return type_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        // The value of the i-th element
+        Json element(std::size_t i) const
+        {
+            switch (type_)
+            {
+                case typed_array_type::uint8_value:
+                    return Json(uint64_t(get<uint8_t>(i)), semantic_tag::none);
+                case typed_array_type::uint16_value:
+                    return Json(uint64_t(get<uint16_t>(i)), semantic_tag::none);
+                case typed_array_type::uint32_value:
+                    return Json(uint64_t(get<uint32_t>(i)), semantic_tag::none);
+                case typed_array_type::uint64_value:
+                    return Json(get<uint64_t>(i), semantic_tag::none);
+                case typed_array_type::int8_value:
+                    return Json(int64_t(get<int8_t>(i)), semantic_tag::none);
+                case typed_array_type::int16_value:
+                    return Json(int64_t(get<int16_t>(i)), semantic_tag::none);
+                case typed_array_type::int32_value:
+                    return Json(int64_t(get<int32_t>(i)), semantic_tag::none);
+                case typed_array_type::int64_value:
+                    return Json(get<int64_t>(i), semantic_tag::none);
+                case typed_array_type::half_value:
+                    return Json(half_arg, get<uint16_t>(i), semantic_tag::none);
+                case typed_array_type::float_value:
+                    return Json(double(get<float>(i)), semantic_tag::none);
+                case typed_array_type::double_value:
+                    return Json(get<double>(i), semantic_tag::none);
+                default:
+                    JSONCONS_UNREACHABLE();
+            }
+        }
+
+        // A regular array of the elements
+        array to_array() const
+        {
+            array elements(get_allocator());
+            elements.reserve(size_);
+            for (std::size_t i = 0; i < size_; ++i)
+            {
+                elements.push_back(element(i));
+            }
+            return elements;
+        }
+
+        // Sends the elements to visitor in one typed array event
+        bool dump(basic_json_visitor<char_type>& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec) const
+        {
+            switch (type_)
+            {
+                case typed_array_type::uint8_value:
+                    return visitor.typed_array(span_of<uint8_t>(), tag, context, ec);
+                case typed_array_type::uint16_value:
+                    return visitor.typed_array(span_of<uint16_t>(), tag, context, ec);
+                case typed_array_type::uint32_value:
+                    return visitor.typed_array(span_of<uint32_t>(), tag, context, ec);
+                case typed_array_type::uint64_value:
+                    return visitor.typed_array(span_of<uint64_t>(), tag, context, ec);
+                case typed_array_type::int8_value:
+                    return visitor.typed_array(span_of<int8_t>(), tag, context, ec);
+                case typed_array_type::int16_value:
+                    return visitor.typed_array(span_of<int16_t>(), tag, context, ec);
+                case typed_array_type::int32_value:
+                    return visitor.typed_array(span_of<int32_t>(), tag, context, ec);
+                case typed_array_type::int64_value:
+                    return visitor.typed_array(span_of<int64_t>(), tag, context, ec);
+                case typed_array_type::half_value:
+                    return visitor.typed_array(half_arg, span_of<uint16_t>(), tag, context, ec);
+                case typed_array_type::float_value:
+                    return visitor.typed_array(span_of<float>(), tag, context, ec);
+                case typed_array_type::double_value:
+                    return visitor.typed_array(span_of<double>(), tag, context, ec);
+                default:
+                    JSONCONS_UNREACHABLE();
+            }
+        }
+    private:
+        template <class T>
+        T get(std::size_t i) const
+        {
+            T value;
+            std::memcpy(&value, reinterpret_cast<const uint8_t*>(words_.data()) + i*sizeof(T), sizeof(T));
+            return value;
+        }
+
+        template <class T>
+        jsoncons::span<const T> span_of() const
+        {
+            return jsoncons::span<const T>(reinterpret_cast<const T*>(words_.data()), size_);
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -701,6 +701,9 @@ namespace jsoncons {
                                const ser_context& context,
                                std::error_code& ec) = 0;
 
+    protected:
+        // The default typed array events send the elements one by one, derived visitors may
+        // forward to them
         virtual bool visit_typed_array(const jsoncons::span<const uint8_t>& s, 
                                     semantic_tag tag,
                                     const ser_context& context, 
@@ -888,7 +891,7 @@ namespace jsoncons {
             }
             return more;
         }
-
+    private:
         virtual bool visit_begin_multi_dim(const jsoncons::span<const size_t>& shape,
                                         semantic_tag tag,
                                         const ser_context& context, 
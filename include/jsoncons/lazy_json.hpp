@@ -0,0 +1,601 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_LAZY_JSON_HPP
+#define JSONCONS_LAZY_JSON_HPP
+
+#include <algorithm> // std::find
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory> // std::shared_ptr
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/decode_json.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Shared by all views of a document. Records the members of each array and object that has
+    // been looked into, keyed by the offset of its opening bracket, and how far the scan has got.
+
+    template <class CharT>
+    class lazy_json_document
+    {
+    public:
+        using char_type = CharT;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        struct member
+        {
+            std::size_t key_first;  // opening quotation mark, objects only
+            std::size_t key_last;   // one past the closing quotation mark
+            std::size_t key_index;  // into escaped_keys_ if the key has escapes, otherwise npos
+            std::size_t first;
+            std::size_t last;
+        };
+    private:
+        struct container
+        {
+            std::vector<member> members;
+            std::size_t scan_pos;
+            bool complete;
+        };
+
+        string_view_type text_;
+        std::unordered_map<std::size_t,container> containers_;
+        std::deque<string_type> escaped_keys_; // stable addresses for the views handed out by key()
+    public:
+        lazy_json_document(const string_view_type& text)
+            : text_(text)
+        {
+        }
+
+        string_view_type text() const
+        {
+            return text_;
+        }
+
+        char_type at(std::size_t pos) const
+        {
+            return text_[pos];
+        }
+
+        std::size_t skip_space(std::size_t pos) const
+        {
+            while (pos < text_.size() && is_space(text_[pos]))
+            {
+                ++pos;
+            }
+            return pos;
+        }
+
+        // Returns the offset just past the value that starts at pos
+        std::size_t value_end(std::size_t pos) const
+        {
+            if (pos >= text_.size())
+            {
+                raise(json_errc::unexpected_eof, pos);
+            }
+            switch (text_[pos])
+            {
+                case '{':
+                case '[':
+                {
+                    structure_skipper skipper;
+                    skipper.reset();
+                    const char_type* first = text_.data() + pos + 1;
+                    std::size_t n = skipper.skip(first, text_.data() + text_.size());
+                    if (!skipper.done())
+                    {
+                        raise(json_errc::unexpected_eof, text_.size());
+                    }
+                    return pos + 1 + n;
+                }
+                case '\"':
+                    return string_end(pos);
+                case ',':
+                case ':':
+                case ']':
+                case '}':
+                    raise(json_errc::expected_value, pos);
+                    return pos;
+                default:
+                {
+                    std::size_t last = pos + 1;
+                    while (last < text_.size() && !is_delimiter(text_[last]))
+                    {
+                        ++last;
+                    }
+                    return last;
+                }
+            }
+        }
+
+        string_view_type key(const member& m) const
+        {
+            if (m.key_index != npos)
+            {
+                return string_view_type(escaped_keys_[m.key_index]);
+            }
+            return text_.substr(m.key_first + 1, m.key_last - m.key_first - 2);
+        }
+
+        const member& member_at(std::size_t container_pos, std::size_t index)
+        {
+            return containers_.find(container_pos)->second.members[index];
+        }
+
+        // Scans until the container has at least count members, returns false if it has fewer
+        bool ensure(std::size_t container_pos, std::size_t count)
+        {
+            container& c = get_container(container_pos);
+            while (c.members.size() < count)
+            {
+                if (!scan_next(container_pos, c))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Returns the index of the member with the given key, or npos
+        std::size_t find(std::size_t container_pos, const string_view_type& name)
+        {
+            container& c = get_container(container_pos);
+            for (std::size_t i = 0; i < c.members.size(); ++i)
+            {
+                if (key(c.members[i]) == name)
+                {
+                    return i;
+                }
+            }
+            while (scan_next(container_pos, c))
+            {
+                if (key(c.members.back()) == name)
+                {
+                    return c.members.size() - 1;
+                }
+            }
+            return npos;
+        }
+
+        std::size_t size(std::size_t container_pos)
+        {
+            container& c = get_container(container_pos);
+            while (scan_next(container_pos, c))
+            {
+            }
+            return c.members.size();
+        }
+
+        void raise(std::error_code ec, std::size_t pos) const
+        {
+            std::size_t line = 1;
+            std::size_t column = 1;
+            for (std::size_t i = 0; i < pos && i < text_.size(); ++i)
+            {
+                if (text_[i] == '\n')
+                {
+                    ++line;
+                    column = 1;
+                }
+                else
+                {
+                    ++column;
+                }
+            }
+            JSONCONS_THROW(ser_error(ec, line, column));
+        }
+    private:
+        static bool is_space(char_type c)
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        static bool is_delimiter(char_type c)
+        {
+            return is_space(c) || c == ',' || c == ']' || c == '}' || c == ':';
+        }
+
+        container& get_container(std::size_t pos)
+        {
+            auto it = containers_.find(pos);
+            if (it == containers_.end())
+            {
+                it = containers_.emplace(pos, container{std::vector<member>(), pos + 1, false}).first;
+            }
+            return it->second;
+        }
+
+        std::size_t string_end(std::size_t pos) const
+        {
+            const char_type* data = text_.data();
+            const char_type* end = data + text_.size();
+            const char_type* p = data + pos + 1;
+            while (p < end)
+            {
+                if (*p == '\\')
+                {
+                    p += 2;
+                }
+                else if (*p == '\"')
+                {
+                    return static_cast<std::size_t>(p - data) + 1;
+                }
+                else
+                {
+                    ++p;
+                }
+            }
+            raise(json_errc::unexpected_eof, text_.size());
+            return text_.size();
+        }
+
+        // Reads the next member of a container, returns false if there are no more
+        bool scan_next(std::size_t container_pos, container& c)
+        {
+            if (c.complete)
+            {
+                return false;
+            }
+            const bool is_object = text_[container_pos] == '{';
+            const char_type close = is_object ? '}' : ']';
+
+            std::size_t pos = skip_space(c.scan_pos);
+            if (pos >= text_.size())
+            {
+                raise(json_errc::unexpected_eof, pos);
+            }
+            if (text_[pos] == close && c.members.empty())
+            {
+                c.complete = true;
+                return false;
+            }
+            if (!c.members.empty())
+            {
+                if (text_[pos] == close)
+                {
+                    c.complete = true;
+                    return false;
+                }
+                if (text_[pos] != ',')
+                {
+                    raise(is_object ? json_errc::expected_comma_or_rbrace : json_errc::expected_comma_or_rbracket, pos);
+                }
+                pos = skip_space(pos + 1);
+                if (pos >= text_.size())
+                {
+                    raise(json_errc::unexpected_eof, pos);
+                }
+            }
+
+            member m{npos, npos, npos, 0, 0};
+            if (is_object)
+            {
+                if (text_[pos] != '\"')
+                {
+                    raise(json_errc::expected_key, pos);
+                }
+                m.key_first = pos;
+                m.key_last = string_end(pos);
+                string_view_type raw = text_.substr(m.key_first + 1, m.key_last - m.key_first - 2);
+                if (std::find(raw.begin(), raw.end(), char_type('\\')) != raw.end())
+                {
+                    escaped_keys_.push_back(decode_json<string_type>(text_.substr(m.key_first, m.key_last - m.key_first)));
+                    m.key_index = escaped_keys_.size() - 1;
+                }
+                pos = skip_space(m.key_last);
+                if (pos >= text_.size() || text_[pos] != ':')
+                {
+                    raise(json_errc::expected_colon, pos);
+                }
+                pos = skip_space(pos + 1);
+            }
+            else if (text_[pos] == close)
+            {
+                raise(json_errc::expected_value, pos);
+            }
+            m.first = pos;
+            m.last = value_end(pos);
+            c.members.push_back(m);
+            c.scan_pos = m.last;
+            return true;
+        }
+    };
+
+    template <class CharT> constexpr std::size_t lazy_json_document<CharT>::npos;
+
+} // namespace detail
+
+    // basic_lazy_json
+
+    // A read-only view of a JSON text in memory that parses only what is navigated. Looking up a
+    // key or an index scans the members of that one object or array, passing over the values of
+    // the others with a structural scan, and records the offsets found so that later lookups and
+    // iteration do not scan again. Values are parsed only by as<T>().
+    //
+    // The text must outlive all views of it. Content that is passed over is checked only for
+    // balanced brackets and quotation marks. Views of one document share their offsets and must
+    // not be used from several threads at once.
+
+    template <class CharT>
+    class basic_lazy_json
+    {
+    public:
+        using char_type = CharT;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+    private:
+        using document_type = detail::lazy_json_document<char_type>;
+
+        static constexpr std::size_t npos = document_type::npos;
+
+        std::shared_ptr<document_type> doc_;
+        std::size_t first_;
+        mutable std::size_t last_;
+
+        basic_lazy_json(const std::shared_ptr<document_type>& doc, std::size_t first, std::size_t last)
+            : doc_(doc), first_(first), last_(last)
+        {
+        }
+
+        template <class Value>
+        class member_iterator
+        {
+            std::shared_ptr<document_type> doc_;
+            std::size_t container_;
+            std::size_t index_;
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Value;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Value*;
+            using reference = Value;
+
+            member_iterator()
+                : container_(0), index_(npos)
+            {
+            }
+
+            member_iterator(const std::shared_ptr<document_type>& doc, std::size_t container, std::size_t index)
+                : doc_(doc), container_(container), index_(index)
+            {
+            }
+
+            Value operator*() const
+            {
+                return make_item(doc_, doc_->member_at(container_, index_), static_cast<Value*>(nullptr));
+            }
+
+            member_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            member_iterator operator++(int)
+            {
+                member_iterator temp(*this);
+                ++index_;
+                return temp;
+            }
+
+            friend bool operator==(const member_iterator& lhs, const member_iterator& rhs)
+            {
+                bool lhs_end = lhs.at_end();
+                bool rhs_end = rhs.at_end();
+                return lhs_end || rhs_end ? lhs_end == rhs_end : lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const member_iterator& lhs, const member_iterator& rhs)
+            {
+                return !(lhs == rhs);
+            }
+        private:
+            bool at_end() const
+            {
+                return index_ == npos || !doc_->ensure(container_, index_ + 1);
+            }
+        };
+    public:
+        // A member of an object
+        class key_value_type;
+
+        using object_iterator = member_iterator<key_value_type>;
+        using array_iterator = member_iterator<basic_lazy_json>;
+
+        explicit basic_lazy_json(const string_view_type& text)
+            : doc_(std::make_shared<document_type>(text)), last_(npos)
+        {
+            first_ = doc_->skip_space(0);
+            if (first_ >= text.size())
+            {
+                doc_->raise(json_errc::unexpected_eof, first_);
+            }
+        }
+
+        basic_lazy_json(const basic_lazy_json&) = default;
+        basic_lazy_json(basic_lazy_json&&) = default;
+        basic_lazy_json& operator=(const basic_lazy_json&) = default;
+        basic_lazy_json& operator=(basic_lazy_json&&) = default;
+
+        bool is_object() const
+        {
+            return doc_->at(first_) == '{';
+        }
+
+        bool is_array() const
+        {
+            return doc_->at(first_) == '[';
+        }
+
+        bool is_string() const
+        {
+            return doc_->at(first_) == '\"';
+        }
+
+        bool is_null() const
+        {
+            return doc_->at(first_) == 'n';
+        }
+
+        bool is_bool() const
+        {
+            return doc_->at(first_) == 't' || doc_->at(first_) == 'f';
+        }
+
+        bool is_number() const
+        {
+            char_type c = doc_->at(first_);
+            return c == '-' || (c >= '0' && c <= '9');
+        }
+
+        // The JSON text of the value
+        string_view_type text() const
+        {
+            if (last_ == npos)
+            {
+                last_ = doc_->value_end(first_);
+            }
+            return doc_->text().substr(first_, last_ - first_);
+        }
+
+        // Number of members of an object or elements of an array, 0 for other values
+        std::size_t size() const
+        {
+            return is_object() || is_array() ? doc_->size(first_) : 0;
+        }
+
+        bool empty() const
+        {
+            return !(is_object() || is_array()) || !doc_->ensure(first_, 1);
+        }
+
+        bool contains(const string_view_type& key) const
+        {
+            return is_object() && doc_->find(first_, key) != npos;
+        }
+
+        basic_lazy_json at(const string_view_type& key) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(not_an_object(key.data(),key.length()));
+            }
+            std::size_t index = doc_->find(first_, key);
+            if (index == npos)
+            {
+                JSONCONS_THROW(key_not_found(key.data(),key.length()));
+            }
+            const auto& m = doc_->member_at(first_, index);
+            return basic_lazy_json(doc_, m.first, m.last);
+        }
+
+        basic_lazy_json operator[](const string_view_type& key) const
+        {
+            return at(key);
+        }
+
+        basic_lazy_json at(std::size_t i) const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+            }
+            if (!doc_->ensure(first_, i + 1))
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            const auto& m = doc_->member_at(first_, i);
+            return basic_lazy_json(doc_, m.first, m.last);
+        }
+
+        basic_lazy_json operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        range<object_iterator,object_iterator> object_range() const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            return range<object_iterator,object_iterator>(object_iterator(doc_, first_, 0), object_iterator());
+        }
+
+        range<array_iterator,array_iterator> array_range() const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return range<array_iterator,array_iterator>(array_iterator(doc_, first_, 0), array_iterator());
+        }
+
+        // Parses the value, which may be a basic_json or any type with json_type_traits
+        template <class T>
+        T as() const
+        {
+            return decode_json<T>(text());
+        }
+    private:
+        static basic_lazy_json make_item(const std::shared_ptr<document_type>& doc, const typename document_type::member& m, basic_lazy_json*)
+        {
+            return basic_lazy_json(doc, m.first, m.last);
+        }
+
+        static key_value_type make_item(const std::shared_ptr<document_type>& doc, const typename document_type::member& m, key_value_type*)
+        {
+            return key_value_type(doc->key(m), basic_lazy_json(doc, m.first, m.last));
+        }
+    };
+
+    template <class CharT> constexpr std::size_t basic_lazy_json<CharT>::npos;
+
+    template <class CharT>
+    class basic_lazy_json<CharT>::key_value_type
+    {
+        friend class basic_lazy_json;
+
+        string_view_type key_;
+        basic_lazy_json value_;
+
+        key_value_type(const string_view_type& key, basic_lazy_json&& value)
+            : key_(key), value_(std::move(value))
+        {
+        }
+    public:
+        string_view_type key() const
+        {
+            return key_;
+        }
+
+        const basic_lazy_json& value() const
+        {
+            return value_;
+        }
+    };
+
+    using lazy_json = basic_lazy_json<char>;
+    using wlazy_json = basic_lazy_json<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
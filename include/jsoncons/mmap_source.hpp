@@ -0,0 +1,347 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MMAP_SOURCE_HPP
+#define JSONCONS_MMAP_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <string>
+#include <utility> // std::swap
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/source.hpp>
+
+#if defined(_WIN32)
+// Keep min and max usable and the rest of the API out, and leave the macros as they were
+#  if !defined(WIN32_LEAN_AND_MEAN)
+#    define WIN32_LEAN_AND_MEAN
+#    define JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#  if !defined(NOMINMAX)
+#    define NOMINMAX
+#    define JSONCONS_UNDEF_NOMINMAX
+#  endif
+#  include <windows.h>
+#  if defined(JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN)
+#    undef WIN32_LEAN_AND_MEAN
+#    undef JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#  if defined(JSONCONS_UNDEF_NOMINMAX)
+#    undef NOMINMAX
+#    undef JSONCONS_UNDEF_NOMINMAX
+#  endif
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+namespace detail {
+
+    // A read-only view of a whole file. An empty file maps to an empty view.
+    class mapped_file
+    {
+        const uint8_t* data_;
+        std::size_t size_;
+        bool error_;
+    #if defined(_WIN32)
+        HANDLE mapping_;
+    #endif
+
+        // Noncopyable
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+    public:
+        mapped_file() noexcept
+            : data_(nullptr), size_(0), error_(false)
+        #if defined(_WIN32)
+              , mapping_(nullptr)
+        #endif
+        {
+        }
+
+        explicit mapped_file(const char* path) noexcept
+            : mapped_file()
+        {
+            open(path);
+        }
+
+        mapped_file(mapped_file&& other) noexcept
+            : mapped_file()
+        {
+            swap(other);
+        }
+
+        ~mapped_file() noexcept
+        {
+            close();
+        }
+
+        mapped_file& operator=(mapped_file&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                swap(other);
+            }
+            return *this;
+        }
+
+        const uint8_t* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool is_error() const noexcept
+        {
+            return error_;
+        }
+
+        void swap(mapped_file& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(error_, other.error_);
+        #if defined(_WIN32)
+            std::swap(mapping_, other.mapping_);
+        #endif
+        }
+    private:
+    #if defined(_WIN32)
+        void open(const char* path) noexcept
+        {
+            HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                error_ = true;
+                return;
+            }
+            LARGE_INTEGER file_size;
+            if (!::GetFileSizeEx(file, &file_size))
+            {
+                ::CloseHandle(file);
+                error_ = true;
+                return;
+            }
+            if (file_size.QuadPart > 0)
+            {
+                mapping_ = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping_ != nullptr)
+                {
+                    data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+                }
+                if (data_ == nullptr)
+                {
+                    error_ = true;
+                }
+                else
+                {
+                    size_ = static_cast<std::size_t>(file_size.QuadPart);
+                }
+            }
+            ::CloseHandle(file);
+        }
+
+        void close() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::UnmapViewOfFile(data_);
+            }
+            if (mapping_ != nullptr)
+            {
+                ::CloseHandle(mapping_);
+            }
+            data_ = nullptr;
+            size_ = 0;
+            mapping_ = nullptr;
+        }
+    #else
+        void open(const char* path) noexcept
+        {
+            int fd = ::open(path, O_RDONLY);
+            if (fd == -1)
+            {
+                error_ = true;
+                return;
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == -1)
+            {
+                ::close(fd);
+                error_ = true;
+                return;
+            }
+            if (st.st_size > 0)
+            {
+                void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    error_ = true;
+                }
+                else
+                {
+                    data_ = static_cast<const uint8_t*>(p);
+                    size_ = static_cast<std::size_t>(st.st_size);
+                #if defined(MADV_SEQUENTIAL)
+                    // Readers consume the file front to back, so ask for aggressive read-ahead
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+                #endif
+                }
+            }
+            ::close(fd);
+        }
+
+        void close() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<uint8_t*>(data_), size_);
+            }
+            data_ = nullptr;
+            size_ = 0;
+        }
+    #endif
+    };
+
+} // namespace detail
+
+    // mmap_source
+
+    // Reads a file through a read-only memory mapping. read_buffer() hands out the whole mapping
+    // without copying. A file that cannot be opened or mapped is reported through is_error().
+    // Cursors take string arguments as JSON text, so pass them an mmap_source rather than a path.
+
+    template <class CharT>
+    class mmap_source
+    {
+    public:
+        using value_type = CharT;
+    private:
+        detail::mapped_file file_;
+        const value_type* data_;
+        const value_type* current_;
+        const value_type* end_;
+
+        // Noncopyable
+        mmap_source(const mmap_source&) = delete;
+        mmap_source& operator=(const mmap_source&) = delete;
+    public:
+        mmap_source()
+            : data_(nullptr), current_(nullptr), end_(nullptr)
+        {
+        }
+
+        explicit mmap_source(const char* path)
+            : file_(path),
+              data_(reinterpret_cast<const value_type*>(file_.data())),
+              current_(data_),
+              end_(data_ + file_.size()/sizeof(value_type))
+        {
+        }
+
+        explicit mmap_source(const std::string& path)
+            : mmap_source(path.c_str())
+        {
+        }
+
+        mmap_source(mmap_source&& other) noexcept
+            : file_(std::move(other.file_)), data_(other.data_), current_(other.current_), end_(other.end_)
+        {
+            other.data_ = other.current_ = other.end_ = nullptr;
+        }
+
+        mmap_source& operator=(mmap_source&& other) noexcept
+        {
+            if (this != &other)
+            {
+                file_ = std::move(other.file_);
+                data_ = other.data_;
+                current_ = other.current_;
+                end_ = other.end_;
+                other.data_ = other.current_ = other.end_ = nullptr;
+            }
+            return *this;
+        }
+
+        bool eof() const
+        {
+            return current_ == end_;
+        }
+
+        bool is_error() const
+        {
+            return file_.is_error();
+        }
+
+        std::size_t position() const
+        {
+            return current_ - data_;
+        }
+
+        void ignore(std::size_t count)
+        {
+            std::size_t len;
+            if (std::size_t(end_ - current_) < count)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = count;
+            }
+            current_ += len;
+        }
+
+        char_result<value_type> peek()
+        {
+            return current_ < end_ ? char_result<value_type>{*current_, false} : char_result<value_type>{0, true};
+        }
+
+        span<const value_type> read_buffer()
+        {
+            const value_type* data = current_;
+            std::size_t length = end_ - current_;
+            current_ = end_;
+
+            return span<const value_type>(data, length);
+        }
+
+        std::size_t read(value_type* p, std::size_t length)
+        {
+            std::size_t len;
+            if (std::size_t(end_ - current_) < length)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = length;
+            }
+            if (len > 0)
+            {
+                std::memcpy(p, current_, len*sizeof(value_type));
+            }
+            current_  += len;
+            return len;
+        }
+    };
+
+    using mmap_binary_source = mmap_source<uint8_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,712 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_SMALL_VECTOR_HPP
+#define JSONCONS_SMALL_VECTOR_HPP
+
+#include <algorithm> // std::move, std::move_backward, std::rotate, std::equal
+#include <cstddef>
+#include <initializer_list>
+#include <iterator> // std::reverse_iterator, std::distance
+#include <memory> // std::allocator, std::allocator_traits, std::pointer_traits
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <type_traits>
+#include <utility> // std::move, std::forward
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/extension_traits.hpp>
+#include <jsoncons/allocator_holder.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // The allocator's pointer to the allocated buffer of a small_vector, kept from the allocation
+    // so that it is never rebuilt from the elements. A plain pointer is the same as the data
+    // pointer and takes no space.
+    template <class Pointer, class T, class Enable = void>
+    class small_vector_buffer_pointer
+    {
+        Pointer ptr_;
+    protected:
+        small_vector_buffer_pointer() noexcept
+            : ptr_()
+        {
+        }
+
+        Pointer get_buffer_pointer(T*) const noexcept
+        {
+            return ptr_;
+        }
+
+        void set_buffer_pointer(Pointer ptr) noexcept
+        {
+            ptr_ = ptr;
+        }
+    };
+
+    template <class Pointer, class T>
+    class small_vector_buffer_pointer<Pointer,T,typename std::enable_if<std::is_same<Pointer,T*>::value>::type>
+    {
+    protected:
+        Pointer get_buffer_pointer(T* data) const noexcept
+        {
+            return data;
+        }
+
+        void set_buffer_pointer(Pointer) noexcept
+        {
+        }
+    };
+
+} // namespace detail
+
+    // small_vector
+
+    // A sequence container with the interface of std::vector that keeps up to N elements
+    // inside itself, and moves them to an allocated buffer when it grows beyond N.
+    // As the elements of a json_array or json object, it puts a small container and its
+    // header in one allocation, rather than one for the header and one for the elements.
+
+    template <class T, class Allocator = std::allocator<T>, std::size_t N = 4>
+    class small_vector : public allocator_holder<Allocator>,
+                         private detail::small_vector_buffer_pointer<typename std::allocator_traits<Allocator>::pointer,T>
+    {
+        static_assert(N > 0, "The inline capacity of a small_vector must be greater than zero");
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type inline_capacity = N;
+
+        using allocator_holder<allocator_type>::get_allocator;
+    private:
+        using alloc_traits = std::allocator_traits<allocator_type>;
+        using alloc_pointer = typename alloc_traits::pointer;
+
+        T* data_;
+        size_type size_;
+        size_type capacity_;
+        alignas(T) unsigned char buffer_[N*sizeof(T)];
+    public:
+        small_vector() noexcept
+            : data_(inline_data()), size_(0), capacity_(N)
+        {
+        }
+
+        explicit small_vector(const allocator_type& alloc) noexcept
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+        }
+
+        explicit small_vector(size_type n, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            resize(n);
+        }
+
+        small_vector(size_type n, const T& value, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            resize(n, value);
+        }
+
+        template <class InputIt,
+                  class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        small_vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            insert(end(), first, last);
+        }
+
+        small_vector(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            insert(end(), init.begin(), init.end());
+        }
+
+        small_vector(const small_vector& other)
+            : allocator_holder<allocator_type>(alloc_traits::select_on_container_copy_construction(other.get_allocator())),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            copy_from(other);
+        }
+
+        small_vector(const small_vector& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            copy_from(other);
+        }
+
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            move_from(other);
+        }
+
+        small_vector(small_vector&& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(inline_data()), size_(0), capacity_(N)
+        {
+            move_from(other);
+        }
+
+        ~small_vector() noexcept
+        {
+            release();
+        }
+
+        small_vector& operator=(const small_vector& other)
+        {
+            if (this != &other)
+            {
+                using propagate = typename alloc_traits::propagate_on_container_copy_assignment;
+                // A buffer from the old allocator can't be kept once the allocator is replaced
+                if (propagate::value && get_allocator() != other.get_allocator())
+                {
+                    release();
+                }
+                else
+                {
+                    clear();
+                }
+                propagate_allocator(other, propagate());
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& other)
+        {
+            if (this != &other)
+            {
+                using propagate = typename alloc_traits::propagate_on_container_move_assignment;
+                // A buffer from the old allocator can't be kept once the allocator is replaced
+                if (propagate::value && get_allocator() != other.get_allocator())
+                {
+                    release();
+                }
+                else
+                {
+                    clear();
+                }
+                propagate_allocator(other, propagate());
+                move_from(other);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(std::initializer_list<T> init)
+        {
+            clear();
+            insert(end(), init.begin(), init.end());
+            return *this;
+        }
+
+        // True if the elements are stored inside the container rather than in an allocated buffer
+        bool is_inline() const noexcept
+        {
+            return data_ == inline_data();
+        }
+
+        iterator begin() noexcept {return data_;}
+        iterator end() noexcept {return data_ + size_;}
+        const_iterator begin() const noexcept {return data_;}
+        const_iterator end() const noexcept {return data_ + size_;}
+        const_iterator cbegin() const noexcept {return data_;}
+        const_iterator cend() const noexcept {return data_ + size_;}
+        reverse_iterator rbegin() noexcept {return reverse_iterator(end());}
+        reverse_iterator rend() noexcept {return reverse_iterator(begin());}
+        const_reverse_iterator rbegin() const noexcept {return const_reverse_iterator(end());}
+        const_reverse_iterator rend() const noexcept {return const_reverse_iterator(begin());}
+
+        bool empty() const noexcept {return size_ == 0;}
+        size_type size() const noexcept {return size_;}
+        size_type capacity() const noexcept {return capacity_;}
+
+        size_type max_size() const noexcept
+        {
+            allocator_type alloc(get_allocator());
+            return alloc_traits::max_size(alloc);
+        }
+
+        T* data() noexcept {return data_;}
+        const T* data() const noexcept {return data_;}
+
+        reference operator[](size_type i) {return data_[i];}
+        const_reference operator[](size_type i) const {return data_[i];}
+
+        reference at(size_type i)
+        {
+            if (i >= size_)
+            {
+                JSONCONS_THROW(std::out_of_range("small_vector index out of range"));
+            }
+            return data_[i];
+        }
+
+        const_reference at(size_type i) const
+        {
+            if (i >= size_)
+            {
+                JSONCONS_THROW(std::out_of_range("small_vector index out of range"));
+            }
+            return data_[i];
+        }
+
+        reference front() {return data_[0];}
+        const_reference front() const {return data_[0];}
+        reference back() {return data_[size_-1];}
+        const_reference back() const {return data_[size_-1];}
+
+        void reserve(size_type n)
+        {
+            if (n > capacity_)
+            {
+                reallocate(n);
+            }
+        }
+
+        // Moves the elements back inside the container if they fit,
+        // otherwise to a buffer of exactly size() elements
+        void shrink_to_fit()
+        {
+            if (!is_inline() && size_ < capacity_)
+            {
+                reallocate(size_);
+            }
+        }
+
+        void clear() noexcept
+        {
+            destroy(data_, data_ + size_);
+            size_ = 0;
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (size_ == capacity_)
+            {
+                return *emplace_reallocate(size_, std::forward<Args>(args)...);
+            }
+            construct(data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+            return back();
+        }
+
+        void pop_back()
+        {
+            --size_;
+            destroy(data_ + size_, data_ + size_ + 1);
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            size_type index = static_cast<size_type>(pos - begin());
+            if (size_ == capacity_)
+            {
+                return emplace_reallocate(index, std::forward<Args>(args)...);
+            }
+            if (index == size_)
+            {
+                construct(data_ + size_, std::forward<Args>(args)...);
+                ++size_;
+                return data_ + index;
+            }
+
+            // Construct the new element first, the arguments may refer to an element of this container
+            alignas(T) unsigned char storage[sizeof(T)];
+            T* temp = reinterpret_cast<T*>(storage);
+            construct(temp, std::forward<Args>(args)...);
+
+            JSONCONS_TRY
+            {
+                construct(data_ + size_, std::move(data_[size_-1]));
+                ++size_;
+                std::move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+                data_[index] = std::move(*temp);
+            }
+            JSONCONS_CATCH(...)
+            {
+                destroy(temp, temp + 1);
+                JSONCONS_RETHROW;
+            }
+            destroy(temp, temp + 1);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator pos, const T& value)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T&& value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        template <class InputIt,
+                  class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            size_type index = static_cast<size_type>(pos - begin());
+            size_type old_size = size_;
+            reserve_for(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            std::rotate(data_ + index, data_ + old_size, data_ + size_);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<T> init)
+        {
+            return insert(pos, init.begin(), init.end());
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            T* p = data_ + (first - begin());
+            T* q = data_ + (last - begin());
+            if (p != q)
+            {
+                T* new_end = std::move(q, data_ + size_, p);
+                destroy(new_end, data_ + size_);
+                size_ = static_cast<size_type>(new_end - data_);
+            }
+            return p;
+        }
+
+        void resize(size_type n)
+        {
+            if (n < size_)
+            {
+                destroy(data_ + n, data_ + size_);
+                size_ = n;
+            }
+            else
+            {
+                reserve(n);
+                while (size_ < n)
+                {
+                    emplace_back();
+                }
+            }
+        }
+
+        void resize(size_type n, const T& value)
+        {
+            if (n < size_)
+            {
+                destroy(data_ + n, data_ + size_);
+                size_ = n;
+            }
+            else
+            {
+                reserve(n);
+                while (size_ < n)
+                {
+                    emplace_back(value);
+                }
+            }
+        }
+
+        // Swapping with an inline side moves elements, which allocates when the allocators
+        // are unequal, so it cannot throw only if stateless allocators always compare equal
+        void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                std::is_empty<Allocator>::value)
+        {
+            if (this == &other)
+            {
+                return;
+            }
+            if (!is_inline() && !other.is_inline())
+            {
+                alloc_pointer ptr = this->get_buffer_pointer(data_);
+                this->set_buffer_pointer(other.get_buffer_pointer(other.data_));
+                other.set_buffer_pointer(ptr);
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+            }
+            else
+            {
+                small_vector temp(std::move(other));
+                other.clear();
+                other.move_from(*this);
+                clear();
+                move_from(temp);
+            }
+        }
+
+        friend bool operator==(const small_vector& lhs, const small_vector& rhs)
+        {
+            return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator!=(const small_vector& lhs, const small_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const small_vector& lhs, const small_vector& rhs)
+        {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend void swap(small_vector& lhs, small_vector& rhs) noexcept(noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+    private:
+        T* inline_data() noexcept
+        {
+            return reinterpret_cast<T*>(buffer_);
+        }
+
+        const T* inline_data() const noexcept
+        {
+            return reinterpret_cast<const T*>(buffer_);
+        }
+
+        template <class... Args>
+        void construct(T* p, Args&&... args)
+        {
+            allocator_type alloc(get_allocator());
+            alloc_traits::construct(alloc, p, std::forward<Args>(args)...);
+        }
+
+        void destroy(T* first, T* last) noexcept
+        {
+            allocator_type alloc(get_allocator());
+            for (; first != last; ++first)
+            {
+                alloc_traits::destroy(alloc, first);
+            }
+        }
+
+        alloc_pointer allocate(size_type n)
+        {
+            allocator_type alloc(get_allocator());
+            return alloc_traits::allocate(alloc, n);
+        }
+
+        void deallocate(alloc_pointer ptr, size_type n) noexcept
+        {
+            allocator_type alloc(get_allocator());
+            alloc_traits::deallocate(alloc, ptr, n);
+        }
+
+        // Destroys the elements and frees the allocated buffer, if any
+        void release() noexcept
+        {
+            clear();
+            if (!is_inline())
+            {
+                deallocate(this->get_buffer_pointer(data_), capacity_);
+                this->set_buffer_pointer(alloc_pointer());
+                data_ = inline_data();
+                capacity_ = N;
+            }
+        }
+
+        // Takes the elements in [p,p+size) and the buffer at ptr, if not inline, with capacity n
+        void adopt(T* p, alloc_pointer ptr, size_type size, size_type n) noexcept
+        {
+            release();
+            data_ = p;
+            size_ = size;
+            capacity_ = n;
+            this->set_buffer_pointer(ptr);
+        }
+
+        // Moves the elements to the inline buffer if n <= N, otherwise to a new buffer of n elements
+        void reallocate(size_type n)
+        {
+            if (is_inline() && n <= N)
+            {
+                return;
+            }
+            if (n <= N)
+            {
+                relocate(data_, data_ + size_, inline_data());
+                adopt(inline_data(), alloc_pointer(), size_, N);
+                return;
+            }
+            alloc_pointer ptr = allocate(n);
+            T* p = extension_traits::to_plain_pointer(ptr);
+            JSONCONS_TRY
+            {
+                relocate(data_, data_ + size_, p);
+            }
+            JSONCONS_CATCH(...)
+            {
+                deallocate(ptr, n);
+                JSONCONS_RETHROW;
+            }
+            adopt(p, ptr, size_, n);
+        }
+
+        // Moves, or copies if moving may throw, [first,last) to uninitialized memory at dest.
+        // The originals are left to release(). If a copy throws, the new elements are destroyed 
+        // and the originals are unchanged.
+        void relocate(T* first, T* last, T* dest)
+        {
+            T* out = dest;
+            JSONCONS_TRY
+            {
+                for (T* p = first; p != last; ++p, ++out)
+                {
+                    construct(out, std::move_if_noexcept(*p));
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                destroy(dest, out);
+                JSONCONS_RETHROW;
+            }
+        }
+
+        // Doubles the size, or grows to max_size() if doubling would exceed it
+        size_type next_capacity() const
+        {
+            const size_type max = max_size();
+            if (size_ >= max)
+            {
+                JSONCONS_THROW(std::length_error("small_vector exceeds max_size"));
+            }
+            size_type n = size_ + (std::max)(size_, N);
+            return (n < size_ || n > max) ? max : n;
+        }
+
+        template <class... Args>
+        T* emplace_reallocate(size_type index, Args&&... args)
+        {
+            size_type n = next_capacity();
+            alloc_pointer ptr = allocate(n);
+            T* p = extension_traits::to_plain_pointer(ptr);
+            bool constructed = false;
+            bool relocated_head = false;
+            JSONCONS_TRY
+            {
+                construct(p + index, std::forward<Args>(args)...);
+                constructed = true;
+                relocate(data_, data_ + index, p);
+                relocated_head = true;
+                relocate(data_ + index, data_ + size_, p + index + 1);
+            }
+            JSONCONS_CATCH(...)
+            {
+                if (relocated_head)
+                {
+                    destroy(p, p + index);
+                }
+                if (constructed)
+                {
+                    destroy(p + index, p + index + 1);
+                }
+                deallocate(ptr, n);
+                JSONCONS_RETHROW;
+            }
+            adopt(p, ptr, size_ + 1, n);
+            return data_ + index;
+        }
+
+        template <class InputIt>
+        void reserve_for(InputIt, InputIt, std::input_iterator_tag)
+        {
+        }
+
+        template <class ForwardIt>
+        void reserve_for(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+        }
+
+        // Replaces the allocator with that of other, the container must have released its buffer
+        void propagate_allocator(const small_vector& other, std::true_type)
+        {
+            allocator_holder<allocator_type>::operator=(other);
+        }
+
+        void propagate_allocator(const small_vector&, std::false_type)
+        {
+        }
+
+        void copy_from(const small_vector& other)
+        {
+            reserve(other.size_);
+            for (const auto& item : other)
+            {
+                emplace_back(item);
+            }
+        }
+
+        // Takes the buffer of other if it has one and the allocators are equal,
+        // otherwise moves its elements one by one. Leaves other empty.
+        void move_from(small_vector& other)
+        {
+            if (!other.is_inline() && get_allocator() == other.get_allocator())
+            {
+                adopt(other.data_, other.get_buffer_pointer(other.data_), other.size_, other.capacity_);
+                other.set_buffer_pointer(alloc_pointer());
+                other.data_ = other.inline_data();
+                other.size_ = 0;
+                other.capacity_ = N;
+            }
+            else
+            {
+                reserve(other.size_);
+                for (auto& item : other)
+                {
+                    construct(data_ + size_, std::move(item));
+                    ++size_;
+                }
+                other.clear();
+            }
+        }
+    };
+
+    template <class T, class Allocator, std::size_t N>
+    constexpr std::size_t small_vector<T,Allocator,N>::inline_capacity;
+
+} // namespace jsoncons
+
+#endif
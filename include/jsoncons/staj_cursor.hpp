@@ -21,6 +21,7 @@
 #include <jsoncons/json_parser.hpp>
 #include <jsoncons/ser_context.hpp>
 #include <jsoncons/sink.hpp>
+#include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons/detail/write_number.hpp>
 #include <jsoncons/json_type_traits.hpp>
 #include <jsoncons/typed_array_view.hpp>
@@ -1144,6 +1145,128 @@ public:
 
     virtual void next(std::error_code& ec) = 0;
 
+    // Consumes the array or object that starts at the current event, and moves to the event after it.
+    // At any other event, the same as next(). Cursors that can find the end of a value without
+    // producing its events override these.
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void skip(std::error_code& ec)
+    {
+        staj_event_type event_type = current().event_type();
+        if (!(event_type == staj_event_type::begin_array || event_type == staj_event_type::begin_object))
+        {
+            next(ec);
+            return;
+        }
+        std::size_t depth = 0;
+        do
+        {
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++depth;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+            next(ec);
+            if (ec) return;
+        }
+        while (depth > 0 && !done());
+    }
+
+    // Moves to the value at a location relative to the value at the current event. The location is a
+    // sequence of reference tokens, such as a jsonpointer::basic_json_pointer. Values that are not on
+    // the path are skipped. Returns false if there is no value at the location, in which case the cursor
+    // is left inside the last container searched.
+    template <class Location>
+    bool seek(const Location& location)
+    {
+        std::error_code ec;
+        bool found = seek(location, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+        return found;
+    }
+
+    template <class Location>
+    bool seek(const Location& location, std::error_code& ec)
+    {
+        for (const auto& token : location)
+        {
+            jsoncons::basic_string_view<CharT> name(token.data(), token.size());
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_object:
+                {
+                    next(ec);
+                    if (ec) return false;
+                    bool match = false;
+                    while (!match)
+                    {
+                        if (done() || current().event_type() != staj_event_type::key)
+                        {
+                            return false;
+                        }
+                        match = current().template get<jsoncons::basic_string_view<CharT>>(ec) == name;
+                        if (ec) return false;
+                        next(ec);
+                        if (ec) return false;
+                        if (!match)
+                        {
+                            skip(ec);
+                            if (ec) return false;
+                        }
+                    }
+                    break;
+                }
+                case staj_event_type::begin_array:
+                {
+                    // An array index has no leading zeros (RFC 6901)
+                    std::size_t index = 0;
+                    if ((name.size() > 1 && name[0] == '0') || 
+                        !jsoncons::detail::to_integer_decimal(name.data(), name.size(), index))
+                    {
+                        return false;
+                    }
+                    next(ec);
+                    if (ec) return false;
+                    for (std::size_t i = 0; i <= index; ++i)
+                    {
+                        if (done() || current().event_type() == staj_event_type::end_array)
+                        {
+                            return false;
+                        }
+                        if (i < index)
+                        {
+                            skip(ec);
+                            if (ec) return false;
+                        }
+                    }
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
     virtual const ser_context& context() const = 0;
 };
 
@@ -1202,6 +1325,24 @@ public:
         }
     }
 
+    void skip() override
+    {
+        cursor_->skip();
+        while (!done() && !pred_(current(),context()))
+        {
+            cursor_->next();
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+        while (!done() && !pred_(current(),context()) && !ec)
+        {
+            cursor_->next(ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
@@ -48,6 +48,13 @@ struct json_array_arg_t
 
 constexpr json_array_arg_t json_array_arg{};
 
+struct typed_array_arg_t
+{
+    explicit typed_array_arg_t() = default; 
+};
+
+constexpr typed_array_arg_t typed_array_arg{};
+
 struct json_object_arg_t
 {
     explicit json_object_arg_t() = default; 
@@ -24,6 +24,7 @@
 #include <limits>
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/extension_traits.hpp>
+#include <jsoncons/detail/simd.hpp>
 
 namespace jsoncons { namespace unicode_traits {
 
@@ -1130,8 +1131,16 @@ namespace jsoncons { namespace unicode_traits {
     {
         conv_errc  result = conv_errc();
         const CharT* last = data + length;
+        const char* first = reinterpret_cast<const char*>(data);
+        data += jsoncons::detail::skip_valid_utf8(first, first + length) - first;
         while (data != last) 
         {
+            if (static_cast<uint8_t>(*data) < 0x80)
+            {
+                const char* p = reinterpret_cast<const char*>(data);
+                data += jsoncons::detail::skip_ascii(p, p + (last - data)) - p;
+                continue;
+            }
             std::size_t len = static_cast<std::size_t>(trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
             if (len > (std::size_t)(last - data))
             {
@@ -199,6 +199,32 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Skips a document or array using the length in its header, without reporting its elements
+    void skip(std::error_code& ec) override
+    {
+        staj_event_type event_type = cursor_visitor_.event().event_type();
+        if (!(event_type == staj_event_type::begin_array || event_type == staj_event_type::begin_object))
+        {
+            read_next(ec);
+            return;
+        }
+        parser_.skip_items(ec);
+        if (ec) return;
+        read_next(ec); // end of the skipped container
+        if (ec) return;
+        read_next(ec);
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -211,6 +211,34 @@ public:
         }
     }
 
+    // Consumes the remaining elements of the document or array at the top of the stack without
+    // reporting them, so that the next call to parse reports its end. Skipped elements are not validated.
+    void skip_items(std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        if (!(state.mode == parse_mode::document || state.mode == parse_mode::array))
+        {
+            return;
+        }
+        // Leave the terminating zero for parse
+        if (JSONCONS_UNLIKELY(state.length < state.pos + 1))
+        {
+            ec = bson_errc::size_mismatch;
+            more_ = false;
+            return;
+        }
+        std::size_t len = state.length - state.pos - 1;
+        std::size_t pos = source_.position();
+        source_.ignore(len);
+        std::size_t n = source_.position() - pos;
+        state.pos += n;
+        if (JSONCONS_UNLIKELY(n != len))
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
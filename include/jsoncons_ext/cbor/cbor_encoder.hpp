@@ -1255,6 +1255,7 @@ private:
                     break;
             }
             write_byte_string_value(byte_string_view(v));
+            end_value();
             return true;
         }
         else
@@ -1282,9 +1283,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint16_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint16_t));
-            std::memcpy(v.data(),data.data(),data.size()*sizeof(uint16_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(uint16_t)));
+            end_value();
             return true;
         }
         else
@@ -1312,9 +1312,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint32_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint32_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(uint32_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(uint32_t)));
+            end_value();
             return true;
         }
         else
@@ -1342,9 +1341,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint64_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint64_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(uint64_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(uint64_t)));
+            end_value();
             return true;
         }
         else
@@ -1370,9 +1368,8 @@ private:
         if (options_.use_typed_arrays())
         {
             write_tag(0x48);
-            std::vector<uint8_t> v(data.size()*sizeof(int8_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int8_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(int8_t)));
+            end_value();
             return true;
         }
         else
@@ -1400,9 +1397,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int16_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int16_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int16_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(int16_t)));
+            end_value();
             return true;
         }
         else
@@ -1430,9 +1426,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int32_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int32_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int32_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(int32_t)));
+            end_value();
             return true;
         }
         else
@@ -1460,9 +1455,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int64_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int64_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int64_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(int64_t)));
+            end_value();
             return true;
         }
         else
@@ -1490,9 +1484,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   half_arg, 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint16_t));
-            std::memcpy(v.data(),data.data(),data.size()*sizeof(uint16_t));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(uint16_t)));
+            end_value();
             return true;
         }
         else
@@ -1520,9 +1513,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   float(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(float));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(float));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(float)));
+            end_value();
             return true;
         }
         else
@@ -1550,9 +1542,8 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   double(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(double));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(double));
-            write_byte_string_value(byte_string_view(v));
+            write_byte_string_value(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(double)));
+            end_value();
             return true;
         }
         else
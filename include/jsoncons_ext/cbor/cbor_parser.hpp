@@ -12,6 +12,7 @@
 #include <memory>
 #include <utility> // std::move
 #include <bitset> // std::bitset
+#include <limits> // std::numeric_limits
 #include <jsoncons/json.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -235,6 +236,13 @@ public:
 
     void parse(item_event_visitor& visitor, std::error_code& ec)
     {
+        if (JSONCONS_UNLIKELY(source_.is_error()))
+        {
+            ec = cbor_errc::source_error;
+            more_ = false;
+            return;
+        }
+
         while (!done_ && more_)
         {
             switch (state_stack_.back().mode)
@@ -350,6 +358,151 @@ public:
             }
         }
     }
+
+    // Consumes the remaining items of the array or map at the top of the stack without reporting
+    // them, so that the next call to parse reports its end. Skipped items are not validated.
+    // Returns false without consuming anything if the items may belong to a stringref namespace.
+    bool skip_items(std::error_code& ec)
+    {
+        if (!stringref_map_stack_.empty())
+        {
+            return false;
+        }
+        more_ = true; // the helpers below stop at !more_
+        const uint64_t indefinite = (std::numeric_limits<uint64_t>::max)();
+
+        // Items outstanding at each level, or indefinite for an indefinite length container
+        std::vector<uint64_t,tag_allocator_type> levels(alloc_);
+        parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+                levels.push_back(state.length - state.index);
+                state.index = state.length;
+                break;
+            case parse_mode::map_key:
+                levels.push_back(2*static_cast<uint64_t>(state.length - state.index));
+                state.index = state.length;
+                break;
+            case parse_mode::indefinite_array:
+            case parse_mode::indefinite_map_key:
+                levels.push_back(indefinite);
+                break;
+            default:
+                return false;
+        }
+
+        while (!levels.empty())
+        {
+            if (levels.back() == 0)
+            {
+                levels.pop_back();
+                continue;
+            }
+            if (source_.is_error())
+            {
+                ec = cbor_errc::source_error;
+                more_ = false;
+                return true;
+            }
+            auto c = source_.peek();
+            if (c.eof)
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return true;
+            }
+            if (levels.back() == indefinite)
+            {
+                if (c.value == 0xff)
+                {
+                    // Leave the break that ends the skipped container for parse
+                    if (levels.size() > 1)
+                    {
+                        source_.ignore(1);
+                    }
+                    levels.pop_back();
+                    continue;
+                }
+            }
+            else
+            {
+                --levels.back();
+            }
+
+            jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value);
+            uint8_t info = get_additional_information_value(c.value);
+            switch (major_type)
+            {
+                case jsoncons::cbor::detail::cbor_major_type::byte_string:
+                case jsoncons::cbor::detail::cbor_major_type::text_string:
+                {
+                    auto func = [](Source& source, std::size_t length, std::error_code& ec) -> bool
+                    {
+                        std::size_t pos = source.position();
+                        source.ignore(length);
+                        if (source.position() - pos != length)
+                        {
+                            ec = cbor_errc::unexpected_eof;
+                            return false;
+                        }
+                        return true;
+                    };
+                    iterate_string_chunks(func, major_type, ec);
+                    break;
+                }
+                case jsoncons::cbor::detail::cbor_major_type::array:
+                case jsoncons::cbor::detail::cbor_major_type::map:
+                {
+                    if (JSONCONS_UNLIKELY(nesting_depth_ + static_cast<int>(levels.size()) > options_.max_nesting_depth()))
+                    {
+                        ec = cbor_errc::max_nesting_depth_exceeded;
+                        more_ = false;
+                        return true;
+                    }
+                    if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                    {
+                        source_.ignore(1);
+                        levels.push_back(indefinite);
+                    }
+                    else
+                    {
+                        uint64_t len = get_uint64_value(ec);
+                        if (major_type == jsoncons::cbor::detail::cbor_major_type::map)
+                        {
+                            if (JSONCONS_UNLIKELY(len > indefinite/2 - 1))
+                            {
+                                ec = cbor_errc::number_too_large;
+                                more_ = false;
+                                return true;
+                            }
+                            len *= 2;
+                        }
+                        levels.push_back(len);
+                    }
+                    break;
+                }
+                case jsoncons::cbor::detail::cbor_major_type::semantic_tag:
+                {
+                    get_uint64_value(ec);
+                    // A tag applies to the item that follows it
+                    if (levels.back() != indefinite)
+                    {
+                        ++levels.back();
+                    }
+                    break;
+                }
+                default:
+                    get_uint64_value(ec);
+                    break;
+            }
+            if (ec)
+            {
+                return true;
+            }
+        }
+        return true;
+    }
 private:
     void read_item(item_event_visitor& visitor, std::error_code& ec)
     {
@@ -1421,7 +1574,8 @@ private:
         auto c = source_.peek();
         if (c.eof)
         {
-            ec = cbor_errc::unexpected_eof;
+            // A source that fails stops delivering, so it's enough to check for that here
+            ec = source_.is_error() ? cbor_errc::source_error : cbor_errc::unexpected_eof;
             more_ = false;
             return;
         }
@@ -53,7 +53,8 @@ namespace jsoncons { namespace jsonpath {
         expected_and,
         expected_comma_or_rparen,
         expected_comma_or_rbracket,
-        expected_relative_path
+        expected_relative_path,
+        not_streamable
     };
 
     class jsonpath_error_category_impl
@@ -144,6 +145,8 @@ namespace jsoncons { namespace jsonpath {
                     return "Expected comma or right bracket";
                 case jsonpath_errc::expected_relative_path:
                     return "Expected unquoted string, or single or double quoted string, or index or '*'";
+                case jsonpath_errc::not_streamable:
+                    return "Expression cannot be evaluated in a single forward pass";
                 default:
                     return "Unknown jsonpath parser error";
             }
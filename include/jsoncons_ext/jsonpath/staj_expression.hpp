@@ -0,0 +1,896 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPATH_STAJ_EXPRESSION_HPP
+#define JSONCONS_JSONPATH_STAJ_EXPRESSION_HPP
+
+#include <algorithm> // std::lower_bound, std::find
+#include <limits> // std::numeric_limits
+#include <memory> // std::unique_ptr
+#include <type_traits> // std::integral_constant
+#include <string>
+#include <system_error>
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
+#include <jsoncons_ext/jsonpath/path_node.hpp>
+
+namespace jsoncons {
+namespace jsonpath {
+
+namespace detail {
+
+    enum class staj_selector_kind {name, wildcard, index, slice, filter};
+
+    template <class Json>
+    struct staj_step
+    {
+        using string_type = typename Json::string_type;
+
+        staj_selector_kind kind;
+        bool recursive;
+        string_type name;
+        std::size_t start;
+        std::size_t stop;
+        std::size_t step;
+        std::unique_ptr<jsonpath_expression<Json>> filter;
+
+        staj_step(staj_selector_kind kind, bool recursive)
+            : kind(kind), recursive(recursive), start(0), stop((std::numeric_limits<std::size_t>::max)()), step(1)
+        {
+        }
+
+        bool selects_index(std::size_t index) const
+        {
+            switch (kind)
+            {
+                case staj_selector_kind::wildcard:
+                    return true;
+                case staj_selector_kind::index:
+                    return index == start;
+                case staj_selector_kind::slice:
+                    return index >= start && index < stop && (index - start) % step == 0;
+                default:
+                    return false;
+            }
+        }
+    };
+
+    // Parses the forward-only subset of JSONPath: the root followed by child names, wildcards,
+    // non-negative indices and slices, recursive descent, and filters that do not refer to the root.
+
+    template <class Json>
+    class staj_path_parser
+    {
+        using char_type = typename Json::char_type;
+        using string_type = typename Json::string_type;
+        using string_view_type = typename Json::string_view_type;
+        using step_type = staj_step<Json>;
+
+        const char_type* begin_;
+        const char_type* p_;
+        const char_type* end_;
+    public:
+        staj_path_parser(const string_view_type& path)
+            : begin_(path.data()), p_(path.data()), end_(path.data() + path.size())
+        {
+        }
+
+        std::size_t column() const
+        {
+            return (p_ - begin_) + 1;
+        }
+
+        std::vector<step_type> parse(std::error_code& ec)
+        {
+            std::vector<step_type> steps;
+
+            skip_space();
+            if (p_ == end_ || *p_ != '$')
+            {
+                ec = jsonpath_errc::expected_root_or_current_node;
+                return steps;
+            }
+            ++p_;
+            skip_space();
+            while (p_ != end_)
+            {
+                if (*p_ == '.')
+                {
+                    ++p_;
+                    bool recursive = false;
+                    if (p_ != end_ && *p_ == '.')
+                    {
+                        recursive = true;
+                        ++p_;
+                    }
+                    skip_space();
+                    if (p_ == end_)
+                    {
+                        ec = jsonpath_errc::unexpected_eof;
+                        return steps;
+                    }
+                    if (recursive && *p_ == '[')
+                    {
+                        parse_bracket(steps, true, ec);
+                    }
+                    else if (*p_ == '*')
+                    {
+                        ++p_;
+                        steps.emplace_back(staj_selector_kind::wildcard, recursive);
+                    }
+                    else
+                    {
+                        const char_type* first = p_;
+                        while (p_ != end_ && !(*p_ == '.' || *p_ == '[' || is_space(*p_)))
+                        {
+                            ++p_;
+                        }
+                        if (p_ == first)
+                        {
+                            ec = jsonpath_errc::expected_relative_path;
+                            return steps;
+                        }
+                        steps.emplace_back(staj_selector_kind::name, recursive);
+                        steps.back().name.assign(first, p_);
+                    }
+                }
+                else if (*p_ == '[')
+                {
+                    parse_bracket(steps, false, ec);
+                }
+                else
+                {
+                    ec = jsonpath_errc::expected_lbracket_or_dot;
+                }
+                if (ec)
+                {
+                    return steps;
+                }
+                skip_space();
+            }
+            return steps;
+        }
+    private:
+        static bool is_space(char_type c)
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        static bool is_digit(char_type c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        void skip_space()
+        {
+            while (p_ != end_ && is_space(*p_))
+            {
+                ++p_;
+            }
+        }
+
+        void parse_bracket(std::vector<step_type>& steps, bool recursive, std::error_code& ec)
+        {
+            ++p_; // '['
+            skip_space();
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::unexpected_eof;
+                return;
+            }
+            switch (*p_)
+            {
+                case '\'':
+                case '\"':
+                    steps.emplace_back(staj_selector_kind::name, recursive);
+                    parse_quoted_name(steps.back().name, ec);
+                    break;
+                case '*':
+                    ++p_;
+                    steps.emplace_back(staj_selector_kind::wildcard, recursive);
+                    break;
+                case '?':
+                    ++p_;
+                    steps.emplace_back(staj_selector_kind::filter, recursive);
+                    parse_filter(steps.back(), ec);
+                    return; // consumes the closing bracket
+                case '-':
+                    // Negative positions count from an end the stream has not reached yet
+                    ec = jsonpath_errc::not_streamable;
+                    return;
+                default:
+                    if (is_digit(*p_) || *p_ == ':')
+                    {
+                        steps.emplace_back(staj_selector_kind::index, recursive);
+                        parse_index_or_slice(steps.back(), ec);
+                    }
+                    else
+                    {
+                        ec = jsonpath_errc::expected_bracket_specifier_or_union;
+                    }
+                    break;
+            }
+            if (ec)
+            {
+                return;
+            }
+            skip_space();
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::expected_rbracket;
+            }
+            else if (*p_ == ',')
+            {
+                // A union reports its selections in union order, not document order
+                ec = jsonpath_errc::not_streamable;
+            }
+            else if (*p_ != ']')
+            {
+                ec = jsonpath_errc::expected_rbracket;
+            }
+            else
+            {
+                ++p_;
+            }
+        }
+
+        bool parse_size(std::size_t& value, std::error_code& ec)
+        {
+            if (p_ != end_ && *p_ == '-')
+            {
+                ec = jsonpath_errc::not_streamable;
+                return false;
+            }
+            const char_type* first = p_;
+            while (p_ != end_ && is_digit(*p_))
+            {
+                ++p_;
+            }
+            if (p_ == first)
+            {
+                return false;
+            }
+            if (!jsoncons::detail::to_integer_decimal(first, p_ - first, value))
+            {
+                ec = jsonpath_errc::invalid_number;
+                return false;
+            }
+            return true;
+        }
+
+        void parse_index_or_slice(step_type& step, std::error_code& ec)
+        {
+            parse_size(step.start, ec);
+            if (ec)
+            {
+                return;
+            }
+            skip_space();
+            if (p_ == end_ || *p_ != ':')
+            {
+                return;
+            }
+            step.kind = staj_selector_kind::slice;
+            ++p_;
+            skip_space();
+            parse_size(step.stop, ec);
+            if (ec)
+            {
+                return;
+            }
+            skip_space();
+            if (p_ == end_ || *p_ != ':')
+            {
+                return;
+            }
+            ++p_;
+            skip_space();
+            if (parse_size(step.step, ec) && step.step == 0)
+            {
+                ec = jsonpath_errc::step_cannot_be_zero;
+            }
+        }
+
+        void parse_quoted_name(string_type& name, std::error_code& ec)
+        {
+            const char_type quote = *p_++;
+            while (p_ != end_ && *p_ != quote)
+            {
+                if (*p_ != '\\')
+                {
+                    name.push_back(*p_++);
+                    continue;
+                }
+                if (++p_ == end_)
+                {
+                    break;
+                }
+                switch (*p_++)
+                {
+                    case '\\': name.push_back('\\'); break;
+                    case '\'': name.push_back('\''); break;
+                    case '\"': name.push_back('\"'); break;
+                    case '/': name.push_back('/'); break;
+                    case 'b': name.push_back('\b'); break;
+                    case 'f': name.push_back('\f'); break;
+                    case 'n': name.push_back('\n'); break;
+                    case 'r': name.push_back('\r'); break;
+                    case 't': name.push_back('\t'); break;
+                    case 'u':
+                    {
+                        uint32_t cp = parse_hex4(ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                        if (unicode_traits::is_high_surrogate(cp))
+                        {
+                            if (end_ - p_ < 2 || p_[0] != '\\' || p_[1] != 'u')
+                            {
+                                ec = jsonpath_errc::invalid_codepoint;
+                                return;
+                            }
+                            p_ += 2;
+                            uint32_t cp2 = parse_hex4(ec);
+                            if (ec)
+                            {
+                                return;
+                            }
+                            cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                        }
+                        unicode_traits::convert(&cp, 1, name);
+                        break;
+                    }
+                    default:
+                        ec = jsonpath_errc::illegal_escaped_character;
+                        return;
+                }
+            }
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::unexpected_eof;
+                return;
+            }
+            ++p_;
+        }
+
+        uint32_t parse_hex4(std::error_code& ec)
+        {
+            uint32_t cp = 0;
+            for (int i = 0; i < 4; ++i, ++p_)
+            {
+                if (p_ == end_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return 0;
+                }
+                char_type c = *p_;
+                if (c >= '0' && c <= '9')
+                {
+                    cp = cp*16 + static_cast<uint32_t>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f')
+                {
+                    cp = cp*16 + static_cast<uint32_t>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F')
+                {
+                    cp = cp*16 + static_cast<uint32_t>(c - 'A' + 10);
+                }
+                else
+                {
+                    ec = jsonpath_errc::invalid_codepoint;
+                    return 0;
+                }
+            }
+            return cp;
+        }
+
+        // Finds the bracket that closes the filter, and compiles the filter as an expression
+        // that selects the matching children of its argument
+        void parse_filter(step_type& step, std::error_code& ec)
+        {
+            const char_type* first = p_;
+            int depth = 0;
+            char_type prev = 0;
+            while (p_ != end_)
+            {
+                char_type c = *p_;
+                if (c == '\'' || c == '\"' || (c == '/' && prev == '~'))
+                {
+                    for (++p_; p_ != end_ && *p_ != c; ++p_)
+                    {
+                        if (*p_ == '\\' && p_ + 1 != end_)
+                        {
+                            ++p_;
+                        }
+                    }
+                    if (p_ == end_)
+                    {
+                        break;
+                    }
+                }
+                else if (c == '$')
+                {
+                    // The root is not available while the stream is being read
+                    ec = jsonpath_errc::not_streamable;
+                    return;
+                }
+                else if (c == '(' || c == '[')
+                {
+                    ++depth;
+                }
+                else if (c == ')' || c == ']')
+                {
+                    if (depth == 0)
+                    {
+                        break;
+                    }
+                    --depth;
+                }
+                if (!is_space(c))
+                {
+                    prev = c;
+                }
+                ++p_;
+            }
+            if (p_ == end_ || *p_ != ']')
+            {
+                ec = jsonpath_errc::expected_rbracket;
+                return;
+            }
+
+            string_type text;
+            text.push_back('$');
+            text.push_back('[');
+            text.push_back('?');
+            text.append(first, p_);
+            text.push_back(']');
+            ++p_;
+
+            auto expr = make_expression<Json>(string_view_type(text), ec);
+            if (ec)
+            {
+                return;
+            }
+            step.filter.reset(new jsonpath_expression<Json>(std::move(expr)));
+        }
+    };
+
+} // namespace detail
+
+    // staj_expression
+
+    // Evaluates a JSONPath expression over the events of a staj cursor in a single forward pass.
+    // Supports child names, wildcards, non-negative indices and slices, recursive descent, and
+    // filters that refer only to the node they test. Values that cannot lead to a match are
+    // passed over with the cursor's skip(), and only matches and filtered candidates are decoded.
+    // Matches are reported in document order.
+
+    template <class Json>
+    class staj_expression
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = typename Json::string_type;
+        using string_view_type = typename Json::string_view_type;
+        using path_node_type = basic_path_node<char_type>;
+    private:
+        using step_type = jsoncons::jsonpath::detail::staj_step<Json>;
+        using selector_kind = jsoncons::jsonpath::detail::staj_selector_kind;
+        using state_set = std::vector<std::size_t>;
+
+        std::vector<step_type> steps_;
+
+        template <class Deliver>
+        struct evaluation
+        {
+            basic_staj_cursor<char_type>& cursor;
+            Deliver& deliver;
+            json_decoder<Json> decoder;
+
+            evaluation(basic_staj_cursor<char_type>& cursor, Deliver& deliver)
+                : cursor(cursor), deliver(deliver)
+            {
+            }
+        };
+
+        // Reports each match as a decoded value and its normalized path, including matches inside other matches
+        template <class BinaryCallback>
+        struct value_delivery
+        {
+            static constexpr bool descend_into_matches = true;
+
+            BinaryCallback& callback;
+
+            void operator()(const path_node_type& path, const Json& value)
+            {
+                callback(to_basic_string(path), value);
+            }
+        };
+
+        // Sends the events of each outermost match to a visitor
+        struct event_delivery
+        {
+            static constexpr bool descend_into_matches = false;
+
+            basic_json_visitor<char_type>& visitor;
+
+            void operator()(const path_node_type&, const Json& value)
+            {
+                value.dump(visitor);
+            }
+
+            void operator()(const path_node_type&, basic_staj_cursor<char_type>& cursor, std::error_code& ec)
+            {
+                std::size_t depth = 0;
+                do
+                {
+                    switch (cursor.current().event_type())
+                    {
+                        case staj_event_type::begin_array:
+                        case staj_event_type::begin_object:
+                            ++depth;
+                            break;
+                        case staj_event_type::end_array:
+                        case staj_event_type::end_object:
+                            --depth;
+                            break;
+                        default:
+                            break;
+                    }
+                    send_json_event(cursor.current(), visitor, cursor.context(), ec);
+                    if (ec) return;
+                    cursor.next(ec);
+                    if (ec) return;
+                }
+                while (depth > 0);
+            }
+        };
+    public:
+        staj_expression(std::vector<step_type>&& steps)
+            : steps_(std::move(steps))
+        {
+        }
+
+        staj_expression(const staj_expression&) = delete;
+        staj_expression(staj_expression&&) = default;
+
+        staj_expression& operator=(const staj_expression&) = delete;
+        staj_expression& operator=(staj_expression&&) = default;
+
+        // Calls callback(path, value) for each match, where path is the normalized path of the match.
+        // The cursor must be at the start of the root value, and is left after it.
+        template <class BinaryCallback>
+        typename std::enable_if<extension_traits::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback) const
+        {
+            std::error_code ec;
+            evaluate(cursor, callback, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+            }
+        }
+
+        template <class BinaryCallback>
+        typename std::enable_if<extension_traits::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback, std::error_code& ec) const
+        {
+            value_delivery<BinaryCallback> deliver{callback};
+            evaluation<value_delivery<BinaryCallback>> eval(cursor, deliver);
+            walk_root(eval, ec);
+        }
+
+        // Sends the events of each match to visitor in turn. A match inside another match is not
+        // reported separately, as its events are part of the enclosing match.
+        void evaluate(basic_staj_cursor<char_type>& cursor, basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            evaluate(cursor, visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+            }
+        }
+
+        void evaluate(basic_staj_cursor<char_type>& cursor, basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            event_delivery deliver{visitor};
+            evaluation<event_delivery> eval(cursor, deliver);
+            walk_root(eval, ec);
+            if (!ec)
+            {
+                visitor.flush();
+            }
+        }
+
+    private:
+        static void insert_state(state_set& states, std::size_t state)
+        {
+            auto it = std::lower_bound(states.begin(), states.end(), state);
+            if (it == states.end() || *it != state)
+            {
+                states.insert(it, state);
+            }
+        }
+
+        bool is_match(const state_set& states) const
+        {
+            return !states.empty() && states.back() == steps_.size();
+        }
+
+        // Computes the states of a child from the states of its parent. Filter steps are returned
+        // separately, since they can only be decided with the child in hand.
+        void child_states(const state_set& states, const string_view_type* name, std::size_t index,
+                          state_set& result, std::vector<std::size_t>& filters) const
+        {
+            result.clear();
+            filters.clear();
+            for (std::size_t state : states)
+            {
+                if (state == steps_.size())
+                {
+                    continue;
+                }
+                const step_type& step = steps_[state];
+                if (step.recursive)
+                {
+                    insert_state(result, state);
+                }
+                if (step.kind == selector_kind::filter)
+                {
+                    filters.push_back(state);
+                }
+                else if (name != nullptr ? (step.kind == selector_kind::wildcard || (step.kind == selector_kind::name && *name == step.name))
+                                         : step.selects_index(index))
+                {
+                    insert_state(result, state+1);
+                }
+            }
+        }
+
+        bool filter_accepts(std::size_t state, Json& value) const
+        {
+            Json wrapper(json_array_arg);
+            wrapper.push_back(std::move(value));
+            bool accepted = false;
+            steps_[state].filter->select(wrapper, [&accepted](const path_node_type&, const Json&){accepted = true;});
+            value = std::move(wrapper[0]);
+            return accepted;
+        }
+
+        template <class Deliver>
+        void walk_root(evaluation<Deliver>& eval, std::error_code& ec) const
+        {
+            if (eval.cursor.done())
+            {
+                return;
+            }
+            state_set states;
+            states.push_back(0);
+            path_node_type root;
+            walk(eval, states, root, ec);
+        }
+
+        template <class Deliver>
+        Json read_value(evaluation<Deliver>& eval, std::error_code& ec) const
+        {
+            eval.decoder.reset();
+            eval.cursor.read_to(eval.decoder, ec);
+            if (ec)
+            {
+                return Json();
+            }
+            eval.cursor.next(ec);
+            return eval.decoder.get_result();
+        }
+
+        // The cursor is at the first event of a value with the given states, and is left after the value
+        template <class Deliver>
+        void walk(evaluation<Deliver>& eval, const state_set& states, const path_node_type& path, std::error_code& ec) const
+        {
+            basic_staj_cursor<char_type>& cursor = eval.cursor;
+
+            if (is_match(states))
+            {
+                deliver_match(eval, states, path, ec);
+                return;
+            }
+
+            state_set states2;
+            std::vector<std::size_t> filters;
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::begin_object:
+                {
+                    string_type name;
+                    cursor.next(ec);
+                    if (ec) return;
+                    while (!cursor.done() && cursor.current().event_type() == staj_event_type::key)
+                    {
+                        auto sv = cursor.current().template get<string_view_type>(ec);
+                        if (ec) return;
+                        name.assign(sv.data(), sv.size());
+                        cursor.next(ec);
+                        if (ec) return;
+                        string_view_type name_view(name);
+                        child_states(states, &name_view, 0, states2, filters);
+                        walk_child(eval, states2, filters, path_node_type(&path, name_view), ec);
+                        if (ec) return;
+                    }
+                    cursor.next(ec);
+                    break;
+                }
+                case staj_event_type::begin_array:
+                {
+                    cursor.next(ec);
+                    if (ec) return;
+                    for (std::size_t index = 0; !cursor.done() && cursor.current().event_type() != staj_event_type::end_array; ++index)
+                    {
+                        child_states(states, nullptr, index, states2, filters);
+                        walk_child(eval, states2, filters, path_node_type(&path, index), ec);
+                        if (ec) return;
+                    }
+                    cursor.next(ec);
+                    break;
+                }
+                default:
+                    cursor.next(ec);
+                    break;
+            }
+        }
+
+        template <class Deliver>
+        void walk_child(evaluation<Deliver>& eval, state_set& states, const std::vector<std::size_t>& filters,
+                        const path_node_type& path, std::error_code& ec) const
+        {
+            if (filters.empty())
+            {
+                if (states.empty())
+                {
+                    eval.cursor.skip(ec);
+                }
+                else
+                {
+                    walk(eval, states, path, ec);
+                }
+                return;
+            }
+
+            Json value = read_value(eval, ec);
+            if (ec) return;
+            for (std::size_t state : filters)
+            {
+                if (filter_accepts(state, value))
+                {
+                    insert_state(states, state+1);
+                }
+            }
+            walk_value(eval.deliver, value, states, path);
+        }
+
+        template <class Deliver>
+        void deliver_match(evaluation<Deliver>& eval, const state_set& states, const path_node_type& path, std::error_code& ec) const
+        {
+            deliver_match(eval, states, path, ec, std::integral_constant<bool,Deliver::descend_into_matches>());
+        }
+
+        template <class Deliver>
+        void deliver_match(evaluation<Deliver>& eval, const state_set& states, const path_node_type& path, std::error_code& ec,
+                           std::true_type) const
+        {
+            Json value = read_value(eval, ec);
+            if (ec) return;
+            walk_value(eval.deliver, value, states, path);
+        }
+
+        template <class Deliver>
+        void deliver_match(evaluation<Deliver>& eval, const state_set&, const path_node_type& path, std::error_code& ec,
+                           std::false_type) const
+        {
+            eval.deliver(path, eval.cursor, ec);
+        }
+
+        // Continues the evaluation on a value that has already been decoded
+        template <class Deliver>
+        void walk_value(Deliver& deliver, const Json& value, const state_set& states, const path_node_type& path) const
+        {
+            if (is_match(states))
+            {
+                deliver(path, value);
+                if (!Deliver::descend_into_matches)
+                {
+                    return;
+                }
+            }
+            if (states.empty() || states.front() == steps_.size() || !(value.is_object() || value.is_array()))
+            {
+                return;
+            }
+
+            // Filters are evaluated once on the parent, which selects the children they accept
+            std::vector<std::pair<std::size_t,std::vector<const Json*>>> accepted;
+            for (std::size_t state : states)
+            {
+                if (state < steps_.size() && steps_[state].kind == selector_kind::filter)
+                {
+                    accepted.emplace_back(state, std::vector<const Json*>());
+                    auto& selected = accepted.back().second;
+                    steps_[state].filter->select(value, [&selected](const path_node_type&, const Json& v){selected.push_back(std::addressof(v));});
+                }
+            }
+
+            state_set states2;
+            std::vector<std::size_t> filters;
+            auto walk_child_value = [&](const Json& child, const path_node_type& child_path)
+            {
+                for (const auto& item : accepted)
+                {
+                    if (std::find(item.second.begin(), item.second.end(), std::addressof(child)) != item.second.end())
+                    {
+                        insert_state(states2, item.first+1);
+                    }
+                }
+                if (!states2.empty())
+                {
+                    walk_value(deliver, child, states2, child_path);
+                }
+            };
+
+            if (value.is_object())
+            {
+                for (const auto& member : value.object_range())
+                {
+                    string_view_type name(member.key());
+                    child_states(states, &name, 0, states2, filters);
+                    walk_child_value(member.value(), path_node_type(&path, name));
+                }
+            }
+            else
+            {
+                std::size_t index = 0;
+                for (const auto& element : value.array_range())
+                {
+                    child_states(states, nullptr, index, states2, filters);
+                    walk_child_value(element, path_node_type(&path, index));
+                    ++index;
+                }
+            }
+        }
+    };
+
+    template <class Json>
+    staj_expression<Json> make_staj_expression(const typename Json::string_view_type& path, std::error_code& ec)
+    {
+        jsoncons::jsonpath::detail::staj_path_parser<Json> parser(path);
+        return staj_expression<Json>(parser.parse(ec));
+    }
+
+    template <class Json>
+    staj_expression<Json> make_staj_expression(const typename Json::string_view_type& path)
+    {
+        jsoncons::jsonpath::detail::staj_path_parser<Json> parser(path);
+        std::error_code ec;
+        auto steps = parser.parse(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpath_error(ec, 1, parser.column()));
+        }
+        return staj_expression<Json>(std::move(steps));
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif
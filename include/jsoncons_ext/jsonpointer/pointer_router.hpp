@@ -0,0 +1,529 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPOINTER_POINTER_ROUTER_HPP
+#define JSONCONS_JSONPOINTER_POINTER_ROUTER_HPP
+
+#include <algorithm> // std::lower_bound
+#include <cstddef>
+#include <memory> // std::unique_ptr
+#include <string>
+#include <system_error>
+#include <type_traits> // std::is_same
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+
+namespace jsoncons { namespace jsonpointer {
+
+namespace detail {
+
+    template <class CharT>
+    class route_handler
+    {
+    public:
+        virtual ~route_handler() noexcept = default;
+
+        virtual basic_json_visitor<CharT>& visitor() = 0;
+
+        // Called after the last event of a match
+        virtual void match_end()
+        {
+        }
+    };
+
+    template <class CharT>
+    class visitor_route_handler : public route_handler<CharT>
+    {
+        basic_json_visitor<CharT>& visitor_;
+    public:
+        visitor_route_handler(basic_json_visitor<CharT>& visitor)
+            : visitor_(visitor)
+        {
+        }
+
+        basic_json_visitor<CharT>& visitor() override
+        {
+            return visitor_;
+        }
+    };
+
+    template <class Json,class Callback>
+    class value_route_handler : public route_handler<typename Json::char_type>
+    {
+        json_decoder<Json> decoder_;
+        Callback callback_;
+    public:
+        value_route_handler(Callback callback)
+            : callback_(callback)
+        {
+        }
+
+        basic_json_visitor<typename Json::char_type>& visitor() override
+        {
+            return decoder_;
+        }
+
+        void match_end() override
+        {
+            if (decoder_.is_valid())
+            {
+                callback_(decoder_.get_result());
+            }
+        }
+    };
+
+} // namespace detail
+
+    // basic_pointer_router
+
+    // A visitor that routes the events of the values at a set of JSON Pointers to per-subscription
+    // handlers in a single pass. The pointers are compiled into a trie, so the cost of a key or
+    // array element does not depend on the number of subscriptions, and a subtree that no pointer
+    // reaches into is passed over with a depth count. Values are routed in document order, and a
+    // value that is inside another routed value is routed to both subscriptions.
+
+    template <class CharT>
+    class basic_pointer_router : public basic_json_visitor<CharT>
+    {
+    public:
+        using typename basic_json_visitor<CharT>::char_type;
+        using typename basic_json_visitor<CharT>::string_view_type;
+        using string_type = std::basic_string<char_type>;
+        using pointer_type = basic_json_pointer<char_type>;
+    private:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        struct trie_node
+        {
+            std::vector<std::pair<string_type,std::size_t>> names; // sorted by name
+            std::vector<std::pair<std::size_t,std::size_t>> indices; // sorted by index
+            std::vector<std::size_t> subscriptions;
+
+            bool is_leaf() const
+            {
+                return names.empty();
+            }
+        };
+
+        struct frame
+        {
+            std::size_t node;
+            std::size_t index;
+            bool is_object;
+        };
+
+        struct match
+        {
+            std::size_t subscription;
+            std::size_t depth;
+        };
+
+        std::vector<trie_node> nodes_;
+        std::vector<std::unique_ptr<detail::route_handler<char_type>>> handlers_;
+        std::vector<frame> frames_;
+        std::vector<match> matches_;
+        std::size_t skip_depth_;
+        std::size_t next_;
+
+        // noncopyable and nonmoveable
+        basic_pointer_router(const basic_pointer_router&) = delete;
+        basic_pointer_router& operator=(const basic_pointer_router&) = delete;
+    public:
+        basic_pointer_router()
+            : nodes_(1), skip_depth_(0), next_(npos)
+        {
+        }
+
+        // Sends the events of the value at location to handler
+        void subscribe(const pointer_type& location, basic_json_visitor<char_type>& handler)
+        {
+            add(location, std::unique_ptr<detail::route_handler<char_type>>(new detail::visitor_route_handler<char_type>(handler)));
+        }
+
+        void subscribe(const string_view_type& location, basic_json_visitor<char_type>& handler)
+        {
+            subscribe(pointer_type(location), handler);
+        }
+
+        // Decodes the value at location and calls callback(Json&&) with it
+        template <class Json,class Callback>
+        void subscribe(const pointer_type& location, Callback callback)
+        {
+            static_assert(std::is_same<typename Json::char_type,char_type>::value, "Json::char_type must be the router's char_type");
+            add(location, std::unique_ptr<detail::route_handler<char_type>>(new detail::value_route_handler<Json,Callback>(callback)));
+        }
+
+        template <class Json,class Callback>
+        void subscribe(const string_view_type& location, Callback callback)
+        {
+            subscribe<Json>(pointer_type(location), callback);
+        }
+
+        std::size_t subscription_count() const
+        {
+            return handlers_.size();
+        }
+
+        // Discards the state of a partly routed document, e.g. after a parse error
+        void reset()
+        {
+            frames_.clear();
+            matches_.clear();
+            skip_depth_ = 0;
+            next_ = npos;
+        }
+
+    private:
+        void add(const pointer_type& location, std::unique_ptr<detail::route_handler<char_type>>&& handler)
+        {
+            std::size_t node = 0;
+            for (const auto& token : location)
+            {
+                node = insert_name(node, token);
+            }
+            nodes_[node].subscriptions.push_back(handlers_.size());
+            handlers_.push_back(std::move(handler));
+        }
+
+        std::size_t insert_name(std::size_t parent, const string_type& token)
+        {
+            auto& names = nodes_[parent].names;
+            auto it = std::lower_bound(names.begin(), names.end(), token,
+                                       [](const std::pair<string_type,std::size_t>& item, const string_type& key) {return item.first < key;});
+            if (it != names.end() && it->first == token)
+            {
+                return it->second;
+            }
+            std::size_t child = nodes_.size();
+            names.insert(it, std::make_pair(token, child));
+
+            // A token that reads as an array index also selects that element of an array,
+            // an array index has no leading zeros (RFC 6901)
+            std::size_t index{0};
+            if (!(token.size() > 1 && token[0] == '0') && 
+                jsoncons::detail::to_integer_decimal(token.data(), token.size(), index))
+            {
+                auto& indices = nodes_[parent].indices;
+                auto it2 = std::lower_bound(indices.begin(), indices.end(), index,
+                                            [](const std::pair<std::size_t,std::size_t>& item, std::size_t key) {return item.first < key;});
+                indices.insert(it2, std::make_pair(index, child));
+            }
+            nodes_.emplace_back(); // invalidates names
+            return child;
+        }
+
+        std::size_t find_name(std::size_t parent, const string_view_type& name) const
+        {
+            const auto& names = nodes_[parent].names;
+            auto it = std::lower_bound(names.begin(), names.end(), name,
+                                       [](const std::pair<string_type,std::size_t>& item, const string_view_type& key) {return string_view_type(item.first).compare(key) < 0;});
+            return it != names.end() && string_view_type(it->first) == name ? it->second : npos;
+        }
+
+        std::size_t find_index(std::size_t parent, std::size_t index) const
+        {
+            const auto& indices = nodes_[parent].indices;
+            auto it = std::lower_bound(indices.begin(), indices.end(), index,
+                                       [](const std::pair<std::size_t,std::size_t>& item, std::size_t key) {return item.first < key;});
+            return it != indices.end() && it->first == index ? it->second : npos;
+        }
+
+        std::size_t depth() const
+        {
+            return frames_.size() + skip_depth_;
+        }
+
+        // Starts the matches of a value that is about to begin
+        void begin_value()
+        {
+            std::size_t node;
+            if (skip_depth_ > 0)
+            {
+                return;
+            }
+            if (frames_.empty())
+            {
+                node = 0;
+            }
+            else if (frames_.back().is_object)
+            {
+                node = next_;
+            }
+            else
+            {
+                node = find_index(frames_.back().node, frames_.back().index++);
+            }
+            next_ = node;
+            if (node != npos)
+            {
+                for (std::size_t subscription : nodes_[node].subscriptions)
+                {
+                    matches_.push_back(match{subscription, depth()});
+                }
+            }
+        }
+
+        void begin_container(bool is_object)
+        {
+            if (skip_depth_ > 0 || next_ == npos || nodes_[next_].is_leaf())
+            {
+                ++skip_depth_;
+            }
+            else
+            {
+                frames_.push_back(frame{next_, 0, is_object});
+            }
+        }
+
+        void end_container()
+        {
+            if (skip_depth_ > 0)
+            {
+                --skip_depth_;
+            }
+            else if (!frames_.empty())
+            {
+                frames_.pop_back();
+            }
+        }
+
+        // Ends the matches of a value that has just ended
+        void end_value()
+        {
+            std::size_t level = depth();
+            auto first = matches_.end();
+            while (first != matches_.begin() && (first-1)->depth == level)
+            {
+                --first;
+            }
+            for (auto it = first; it != matches_.end(); ++it)
+            {
+                handlers_[it->subscription]->match_end();
+            }
+            matches_.erase(first, matches_.end());
+        }
+
+        basic_json_visitor<char_type>& handler(const match& m)
+        {
+            return handlers_[m.subscription]->visitor();
+        }
+
+        void visit_flush() override
+        {
+            for (auto& h : handlers_)
+            {
+                h->visitor().flush();
+            }
+        }
+
+        bool visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).begin_object(tag, context, ec);
+                if (ec) return false;
+            }
+            begin_container(true);
+            return true;
+        }
+
+        bool visit_begin_object(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).begin_object(length, tag, context, ec);
+                if (ec) return false;
+            }
+            begin_container(true);
+            return true;
+        }
+
+        bool visit_end_object(const ser_context& context, std::error_code& ec) override
+        {
+            for (const auto& m : matches_)
+            {
+                handler(m).end_object(context, ec);
+                if (ec) return false;
+            }
+            end_container();
+            end_value();
+            return true;
+        }
+
+        bool visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).begin_array(tag, context, ec);
+                if (ec) return false;
+            }
+            begin_container(false);
+            return true;
+        }
+
+        bool visit_begin_array(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).begin_array(length, tag, context, ec);
+                if (ec) return false;
+            }
+            begin_container(false);
+            return true;
+        }
+
+        bool visit_end_array(const ser_context& context, std::error_code& ec) override
+        {
+            for (const auto& m : matches_)
+            {
+                handler(m).end_array(context, ec);
+                if (ec) return false;
+            }
+            end_container();
+            end_value();
+            return true;
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) override
+        {
+            for (const auto& m : matches_)
+            {
+                handler(m).key(name, context, ec);
+                if (ec) return false;
+            }
+            if (skip_depth_ == 0 && !frames_.empty())
+            {
+                next_ = find_name(frames_.back().node, name);
+            }
+            return true;
+        }
+
+        bool visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).null_value(tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).bool_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).string_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).byte_string_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_byte_string(const byte_string_view& value, uint64_t ext_tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).byte_string_value(value, ext_tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).uint64_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).int64_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).half_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+
+        bool visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_value();
+            for (const auto& m : matches_)
+            {
+                handler(m).double_value(value, tag, context, ec);
+                if (ec) return false;
+            }
+            end_value();
+            return true;
+        }
+    };
+
+    template <class CharT> constexpr std::size_t basic_pointer_router<CharT>::npos;
+
+    using pointer_router = basic_pointer_router<char>;
+    using wpointer_router = basic_pointer_router<wchar_t>;
+
+} // namespace jsonpointer
+} // namespace jsoncons
+
+#endif
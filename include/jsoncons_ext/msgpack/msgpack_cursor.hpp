@@ -193,6 +193,33 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Skips an array or map using the lengths in its headers, without reporting its items
+    void skip(std::error_code& ec) override
+    {
+        staj_event_type event_type = cursor_visitor_.event().event_type();
+        if (!(event_type == staj_event_type::begin_array || event_type == staj_event_type::begin_object)
+            || cursor_visitor_.in_available())
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+            return;
+        }
+        parser_.skip_items(ec);
+        if (ec) return;
+        read_next(ec); // end of the skipped container
+        if (ec) return;
+        read_next(ec);
+    }
+
     const ser_context& context() const override
     {
         return *this;
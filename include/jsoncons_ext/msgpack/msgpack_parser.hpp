@@ -195,6 +195,131 @@ public:
             }
         }
     }
+
+    // Consumes the remaining items of the array or map at the top of the stack without reporting
+    // them, so that the next call to parse reports its end. Skipped items are not validated.
+    void skip_items(std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        if (!(state.mode == parse_mode::array || state.mode == parse_mode::map_key))
+        {
+            return;
+        }
+        uint64_t count = state.length - state.index;
+        if (state.mode == parse_mode::map_key)
+        {
+            count *= 2;
+        }
+        state.index = state.length;
+
+        while (count > 0)
+        {
+            --count;
+            if (source_.is_error())
+            {
+                ec = msgpack_errc::source_error;
+                more_ = false;
+                return;
+            }
+            uint8_t type;
+            if (source_.read(&type, 1) == 0)
+            {
+                ec = msgpack_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            std::size_t len = 0;
+            if (type <= 0x7f || type >= 0xe0)
+            {
+                // positive or negative fixint
+            }
+            else if (type <= 0x8f)
+            {
+                count += 2*static_cast<uint64_t>(type & 0x0f); // fixmap
+            }
+            else if (type <= 0x9f)
+            {
+                count += type & 0x0f; // fixarray
+            }
+            else if (type <= 0xbf)
+            {
+                len = type & 0x1f; // fixstr
+            }
+            else
+            {
+                switch (type)
+                {
+                    case jsoncons::msgpack::msgpack_type::nil_type: 
+                    case jsoncons::msgpack::msgpack_type::true_type:
+                    case jsoncons::msgpack::msgpack_type::false_type:
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint8_type: 
+                    case jsoncons::msgpack::msgpack_type::int8_type: 
+                        len = 1;
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint16_type: 
+                    case jsoncons::msgpack::msgpack_type::int16_type: 
+                        len = 2;
+                        break;
+                    case jsoncons::msgpack::msgpack_type::float32_type: 
+                    case jsoncons::msgpack::msgpack_type::uint32_type: 
+                    case jsoncons::msgpack::msgpack_type::int32_type: 
+                        len = 4;
+                        break;
+                    case jsoncons::msgpack::msgpack_type::float64_type: 
+                    case jsoncons::msgpack::msgpack_type::uint64_type: 
+                    case jsoncons::msgpack::msgpack_type::int64_type: 
+                        len = 8;
+                        break;
+                    case jsoncons::msgpack::msgpack_type::str8_type: 
+                    case jsoncons::msgpack::msgpack_type::str16_type: 
+                    case jsoncons::msgpack::msgpack_type::str32_type: 
+                    case jsoncons::msgpack::msgpack_type::bin8_type: 
+                    case jsoncons::msgpack::msgpack_type::bin16_type: 
+                    case jsoncons::msgpack::msgpack_type::bin32_type: 
+                        len = get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::fixext1_type: 
+                    case jsoncons::msgpack::msgpack_type::fixext2_type: 
+                    case jsoncons::msgpack::msgpack_type::fixext4_type: 
+                    case jsoncons::msgpack::msgpack_type::fixext8_type: 
+                    case jsoncons::msgpack::msgpack_type::fixext16_type: 
+                    case jsoncons::msgpack::msgpack_type::ext8_type: 
+                    case jsoncons::msgpack::msgpack_type::ext16_type: 
+                    case jsoncons::msgpack::msgpack_type::ext32_type: 
+                        len = get_size(type, ec) + 1; // ext type and payload
+                        break;
+                    case jsoncons::msgpack::msgpack_type::array16_type: 
+                    case jsoncons::msgpack::msgpack_type::array32_type: 
+                        count += get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::map16_type : 
+                    case jsoncons::msgpack::msgpack_type::map32_type : 
+                        count += 2*static_cast<uint64_t>(get_size(type, ec));
+                        break;
+                    default:
+                        ec = msgpack_errc::unknown_type;
+                        more_ = false;
+                        break;
+                }
+                if (ec)
+                {
+                    return;
+                }
+            }
+            if (len > 0)
+            {
+                std::size_t pos = source_.position();
+                source_.ignore(len);
+                if (source_.position() - pos != len)
+                {
+                    ec = msgpack_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+            }
+        }
+    }
 private:
 
     void read_item(item_event_visitor& visitor, std::error_code& ec)
@@ -9,6 +9,7 @@
 #include <jsoncons_ext/bson/bson_cursor.hpp>
 #include <jsoncons_ext/bson/bson.hpp>
 #include <catch/catch.hpp>
+#include <common/seek_test_utilities.hpp>
 #include <sstream>
 #include <vector>
 #include <utility>
@@ -302,3 +303,124 @@ TEMPLATE_TEST_CASE("bson_cursor reset test", "",
         check_bson_cursor_document("third document", cursor, "c", 3);
     }
 }
+
+namespace {
+
+    struct event_record
+    {
+        staj_event_type type;
+        std::string value;
+        std::size_t column;
+
+        friend bool operator==(const event_record& lhs, const event_record& rhs)
+        {
+            return lhs.type == rhs.type && lhs.value == rhs.value && lhs.column == rhs.column;
+        }
+    };
+
+    event_record record_event(const staj_cursor& cursor)
+    {
+        const staj_event& event = cursor.current();
+        std::string value;
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+                value = event.get<std::string>();
+                break;
+            default:
+                break;
+        }
+        return event_record{event.event_type(), value, cursor.context().column()};
+    }
+
+    void check_skip_at_every_container(const std::vector<uint8_t>& data)
+    {
+        std::vector<event_record> events;
+        {
+            bson::bson_bytes_cursor cursor(data);
+            for (; !cursor.done(); cursor.next())
+            {
+                events.push_back(record_event(cursor));
+            }
+        }
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            if (!(events[i].type == staj_event_type::begin_array || events[i].type == staj_event_type::begin_object))
+            {
+                continue;
+            }
+            std::size_t j = i;
+            std::size_t depth = 0;
+            do
+            {
+                if (events[j].type == staj_event_type::begin_array || events[j].type == staj_event_type::begin_object)
+                {
+                    ++depth;
+                }
+                else if (events[j].type == staj_event_type::end_array || events[j].type == staj_event_type::end_object)
+                {
+                    --depth;
+                }
+                ++j;
+            }
+            while (depth > 0);
+
+            bson::bson_bytes_cursor cursor(data);
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                cursor.next();
+            }
+            cursor.skip();
+            if (j == events.size())
+            {
+                CHECK(cursor.done());
+            }
+            else
+            {
+                REQUIRE_FALSE(cursor.done());
+                CHECK(record_event(cursor) == events[j]);
+            }
+        }
+    }
+
+} // namespace
+
+TEST_CASE("bson_cursor skip")
+{
+    json j = json::parse(R"(
+{
+    "a" : [1, -2, 5000000000, 1.5, "short", true, null],
+    "b" : {"c" : [[], {}, [[1]]], "d" : {"e" : "f"}},
+    "g" : [{"h" : [1,2,3]}, 4]
+}
+    )");
+
+    std::vector<uint8_t> data;
+    bson::encode_bson(j, data);
+
+    SECTION("every container")
+    {
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("unexpected eof")
+    {
+        std::vector<uint8_t> truncated(data.begin(), data.end() - 10);
+        bson::bson_bytes_cursor cursor(truncated);
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == bson::bson_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("bson_cursor seek")
+{
+    std::vector<uint8_t> data;
+    bson::encode_bson(seek_test_document(), data);
+    check_seek<bson::bson_bytes_cursor>(data);
+}
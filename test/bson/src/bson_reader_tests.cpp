@@ -3,7 +3,10 @@
 
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -38,3 +41,42 @@ TEST_CASE("bson hello world")
                       },json::parse("{\"hello\":\"world\"}"));
 }
 
+TEST_CASE("bson reader and cursor with mmap_binary_source")
+{
+    json j = json::parse(R"({"title":"Canada","values":[1,2.5,"three",null,true]})");
+    std::string path = "./corelib/output/mmap_source.bson";
+    {
+        std::ofstream os(path, std::ios::binary);
+        bson::encode_bson(j, os);
+    }
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        bson::basic_bson_reader<jsoncons::mmap_binary_source> reader(path, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("cursor")
+    {
+        bson::basic_bson_cursor<jsoncons::mmap_binary_source> cursor(path);
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count == 12);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        bson::basic_bson_reader<jsoncons::mmap_binary_source> reader("./corelib/output/no-such-file.bson", decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == bson::bson_errc::source_error);
+    }
+
+    std::remove(path.c_str());
+}
@@ -9,6 +9,7 @@
 #include <jsoncons_ext/cbor/cbor_cursor.hpp>
 #include <jsoncons_ext/cbor/cbor.hpp>
 #include <catch/catch.hpp>
+#include <common/seek_test_utilities.hpp>
 #include <sstream>
 #include <vector>
 #include <utility>
@@ -384,3 +385,198 @@ TEMPLATE_TEST_CASE("cbor_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    struct event_record
+    {
+        staj_event_type type;
+        std::string value;
+        std::size_t column;
+
+        friend bool operator==(const event_record& lhs, const event_record& rhs)
+        {
+            return lhs.type == rhs.type && lhs.value == rhs.value && lhs.column == rhs.column;
+        }
+    };
+
+    event_record record_event(const staj_cursor& cursor)
+    {
+        const staj_event& event = cursor.current();
+        std::string value;
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+                value = event.get<std::string>();
+                break;
+            default:
+                break;
+        }
+        return event_record{event.event_type(), value, cursor.context().column()};
+    }
+
+    void check_skip_at_every_container(const std::vector<uint8_t>& data)
+    {
+        std::vector<event_record> events;
+        {
+            cbor::cbor_bytes_cursor cursor(data);
+            for (; !cursor.done(); cursor.next())
+            {
+                events.push_back(record_event(cursor));
+            }
+        }
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            if (!(events[i].type == staj_event_type::begin_array || events[i].type == staj_event_type::begin_object))
+            {
+                continue;
+            }
+            std::size_t j = i;
+            std::size_t depth = 0;
+            do
+            {
+                if (events[j].type == staj_event_type::begin_array || events[j].type == staj_event_type::begin_object)
+                {
+                    ++depth;
+                }
+                else if (events[j].type == staj_event_type::end_array || events[j].type == staj_event_type::end_object)
+                {
+                    --depth;
+                }
+                ++j;
+            }
+            while (depth > 0);
+
+            cbor::cbor_bytes_cursor cursor(data);
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                cursor.next();
+            }
+            cursor.skip();
+            if (j == events.size())
+            {
+                CHECK(cursor.done());
+            }
+            else
+            {
+                REQUIRE_FALSE(cursor.done());
+                CHECK(record_event(cursor) == events[j]);
+            }
+        }
+    }
+
+} // namespace
+
+TEST_CASE("cbor_cursor skip")
+{
+    json j = json::parse(R"(
+{
+    "a" : [1, -2, 300, -70000, 5000000000, 1.5, "short", "a string longer than twenty three characters", true, null],
+    "b" : {"c" : [[], {}, [[1]]], "d" : {"e" : "f"}},
+    "g" : [{"h" : [1,2,3]}, 4]
+}
+    )");
+    j["bytes"] = json(byte_string_arg, std::vector<uint8_t>{1,2,3,4,5});
+    j["bignum"] = json::parse("18446744073709551616");
+    j["date"] = json("2023-01-01T00:00:00Z", semantic_tag::datetime);
+
+    SECTION("every container")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("stringref namespace")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data, cbor::cbor_options().pack_strings(true));
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("indefinite length")
+    {
+        // [_ 1, {_ "a": (_ "b", "c"), "d": [_ ]}, 1(1363896240), [1, 2], 1.1, h'0102']
+        std::vector<uint8_t> data = {0x9f,0x01,
+                                     0xbf,0x61,'a',0x7f,0x61,'b',0x61,'c',0xff,0x61,'d',0x9f,0xff,0xff,
+                                     0xc1,0x1a,0x51,0x4b,0x67,0xb0,
+                                     0x82,0x01,0x02,
+                                     0xfb,0x3f,0xf1,0x99,0x99,0x99,0x99,0x99,0x9a,
+                                     0x42,0x01,0x02,
+                                     0xff};
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("typed array")
+    {
+        std::vector<uint8_t> data = {0x82,0xd8,0x40,0x43,0x01,0x02,0x03,0x05}; // [64(h'010203'), 5]
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<int>() == 5);
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("end events")
+    {
+        std::vector<uint8_t> data2;
+        cbor::encode_cbor(json::parse(R"([[1,2],{"a":3},4])"), data2);
+
+        cbor::cbor_bytes_cursor cursor(data2);
+        for (int i = 0; i < 4; ++i)
+        {
+            cursor.next();
+        }
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.skip();
+        REQUIRE_FALSE(cursor.done());
+        CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.skip();
+        REQUIRE_FALSE(cursor.done());
+        CHECK(cursor.current().get<int>() == 4);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.skip();
+        CHECK(cursor.done());
+    }
+
+    SECTION("unexpected eof")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        std::vector<uint8_t> truncated(data.begin(), data.end() - 10);
+        cbor::cbor_bytes_cursor cursor(truncated);
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("cbor_cursor seek")
+{
+    json j = seek_test_document();
+
+    SECTION("definite length")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        check_seek<cbor::cbor_bytes_cursor>(data);
+    }
+
+    SECTION("stringref namespace")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data, cbor::cbor_options().pack_strings(true));
+        check_seek<cbor::cbor_bytes_cursor>(data);
+    }
+}
@@ -7,8 +7,11 @@
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/cbor/cbor.hpp>
 #include <jsoncons_ext/cbor/cbor_reader.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <catch/catch.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -734,3 +737,43 @@ TEST_CASE("CBOR stringref tag 3")
 
     CHECK(expected == j);
 }
+
+TEST_CASE("cbor reader and cursor with mmap_binary_source")
+{
+    json j = json::parse(R"({"title":"Canada","values":[1,2.5,"three",null,true],"bytes":"0x0a0b"})");
+    std::string path = "./corelib/output/mmap_source.cbor";
+    {
+        std::ofstream os(path, std::ios::binary);
+        cbor::encode_cbor(j, os);
+    }
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<jsoncons::mmap_binary_source> reader(path, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("cursor")
+    {
+        cbor::basic_cbor_cursor<jsoncons::mmap_binary_source> cursor(path);
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count == 14);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<jsoncons::mmap_binary_source> reader("./corelib/output/no-such-file.cbor", decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == cbor::cbor_errc::source_error);
+    }
+
+    std::remove(path.c_str());
+}
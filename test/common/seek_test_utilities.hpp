@@ -0,0 +1,101 @@
+#ifndef JSONCONS_TESTS_SEEK_TEST_UTILITIES_HPP
+#define JSONCONS_TESTS_SEEK_TEST_UTILITIES_HPP
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// The document that the seek tests of every cursor encode in their format
+inline
+jsoncons::json seek_test_document()
+{
+    return jsoncons::json::parse(R"(
+{
+    "store" : {
+        "book" : [
+            {"author" : "Nigel Rees", "title" : "Sayings of the Century", "price" : 8.95, "tags" : ["a","b"]},
+            {"author" : "Evelyn Waugh", "title" : "Sword of Honour", "price" : 12.99, "tags" : []}
+        ],
+        "bicycle" : {"color" : "red", "price" : 19.95},
+        "a/b" : 1,
+        "m~n" : {"" : 2}
+    },
+    "flag" : true,
+    "nothing" : null
+}
+    )");
+}
+
+inline
+void collect_locations(const jsoncons::json& j, const jsoncons::jsonpointer::json_pointer& location,
+                       std::vector<jsoncons::jsonpointer::json_pointer>& locations)
+{
+    locations.push_back(location);
+    if (j.is_object())
+    {
+        for (const auto& member : j.object_range())
+        {
+            collect_locations(member.value(), location / member.key(), locations);
+        }
+    }
+    else if (j.is_array())
+    {
+        for (std::size_t i = 0; i < j.size(); ++i)
+        {
+            collect_locations(j[i], location / i, locations);
+        }
+    }
+}
+
+// Checks Cursor::seek on data, the seek_test_document encoded in the cursor's format
+template <class Cursor,class Data>
+void check_seek(const Data& data)
+{
+    using jsoncons::jsonpointer::json_pointer;
+
+    jsoncons::json j = seek_test_document();
+
+    // every location
+    std::vector<json_pointer> locations;
+    collect_locations(j, json_pointer(), locations);
+    for (const auto& location : locations)
+    {
+        Cursor cursor(data);
+        REQUIRE(cursor.seek(location));
+        jsoncons::json_decoder<jsoncons::json> decoder;
+        cursor.read_to(decoder);
+        CHECK(decoder.get_result() == jsoncons::jsonpointer::get(j, location));
+    }
+
+    // missing locations
+    std::vector<std::string> missing = {"/missing", "/store/book/2", "/store/book/-", "/store/book/x",
+                                        "/store/book/01x", "/store/book/01", "/store/book/00",
+                                        "/flag/0", "/nothing/a", "/store/bicycle/color/0"};
+    for (const auto& location : missing)
+    {
+        Cursor cursor(data);
+        CHECK_FALSE(cursor.seek(json_pointer(location)));
+    }
+
+    // seek relative to the current event, and decode after seek
+    Cursor cursor(data);
+    REQUIRE(cursor.seek(json_pointer("/store/book/1/price")));
+    CHECK(cursor.current().template get<double>() == 12.99);
+    cursor.next();
+    REQUIRE(cursor.seek(json_pointer()));
+    CHECK(cursor.current().template get<std::string>() == "tags");
+
+    Cursor cursor2(data);
+    REQUIRE(cursor2.seek(json_pointer("/store/book/0/tags")));
+    jsoncons::json_decoder<jsoncons::json> decoder;
+    std::error_code ec;
+    auto tags = jsoncons::decode_traits<std::vector<std::string>,char>::decode(cursor2, decoder, ec);
+    CHECK_FALSE(ec);
+    CHECK(tags.size() == 2);
+}
+
+#endif
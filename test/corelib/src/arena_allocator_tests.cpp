@@ -0,0 +1,207 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <catch/catch.hpp>
+
+#if defined(JSONCONS_HAS_STATEFUL_ALLOCATOR)
+
+using namespace jsoncons;
+
+TEST_CASE("arena allocate")
+{
+    arena a(64);
+    CHECK(a.capacity() == 0);
+
+    SECTION("alignment")
+    {
+        void* p1 = a.allocate(1, 1);
+        void* p2 = a.allocate(sizeof(double), alignof(double));
+        void* p3 = a.allocate(3, 1);
+        void* p4 = a.allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+
+        CHECK(p1 != p2);
+        CHECK(reinterpret_cast<std::uintptr_t>(p2) % alignof(double) == 0);
+        CHECK(p3 != p4);
+        CHECK(reinterpret_cast<std::uintptr_t>(p4) % alignof(std::uint64_t) == 0);
+    }
+
+    SECTION("larger than block")
+    {
+        char* p = static_cast<char*>(a.allocate(1000, 1));
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            p[i] = 'a';
+        }
+        CHECK(a.capacity() >= 1000);
+    }
+
+    SECTION("too large")
+    {
+        const std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+        CHECK_THROWS_AS(a.allocate(max_size, 1), std::bad_alloc);
+        CHECK_THROWS_AS(a.allocate(max_size - 8, 16), std::bad_alloc);
+        CHECK_THROWS_AS(a.allocate(max_size/2 + 1, 1), std::bad_alloc);
+        CHECK(a.capacity() == 0);
+    }
+
+        SECTION("release")
+    {
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            a.allocate(24);
+        }
+        CHECK(a.capacity() >= 2400);
+        a.release();
+        CHECK(a.capacity() == 0);
+        CHECK(a.allocate(8) != nullptr);
+    }
+}
+
+TEST_CASE("arena_allocator")
+{
+    arena a1;
+    arena a2;
+
+    arena_allocator<char> alloc1(a1);
+    arena_allocator<int> alloc2(alloc1);
+    arena_allocator<char> alloc3(a2);
+
+    CHECK(alloc1 == alloc2);
+    CHECK(alloc1 != alloc3);
+    CHECK(alloc2.resource() == &a1);
+
+    std::vector<int,arena_allocator<int>> v(alloc2);
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    CHECK(v.size() == 1000);
+    CHECK(v[999] == 999);
+    CHECK(a1.capacity() >= 1000*sizeof(int));
+    CHECK(a2.capacity() == 0);
+
+    // n*sizeof(T) would wrap around
+    const std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+    std::size_t capacity = a1.capacity();
+    CHECK_THROWS_AS(alloc2.allocate(max_size/sizeof(int) + 1), std::bad_alloc);
+    CHECK_THROWS_AS(alloc2.allocate(max_size/2 + 1), std::bad_alloc);
+    CHECK(a1.capacity() == capacity);
+}
+
+TEST_CASE("arena_json parse")
+{
+    std::string input = R"(
+{"foo" : [{"short" : "bar",
+          "long" : "string too long for short string",
+          "false" : false,
+          "true" : true,
+          "null" : null,
+          "integer" : 10,
+          "double" : 1000.1}]
+}
+    )";
+
+    SECTION("parse string")
+    {
+        arena a;
+        arena_json j = arena_json::parse(a, input);
+        CHECK(a.capacity() > 0);
+
+        const arena_json& b = j.at("foo").at(0);
+        CHECK(b.at("short").as_string_view() == "bar");
+        CHECK(b.at("long").as_string_view() == "string too long for short string");
+        CHECK(b.at("integer").as<int>() == 10);
+        CHECK(b.at("double").as<double>() == Approx(1000.1).epsilon(0.001));
+        CHECK(b.at("null").is_null());
+    }
+
+    SECTION("parse c string")
+    {
+        arena a;
+        arena_ojson j = arena_ojson::parse(a, input.c_str());
+        CHECK(j.at("foo").at(0).at("true").as<bool>());
+        CHECK(j.at("foo").at(0).object_range().begin()->value().as_string_view() == "bar");
+    }
+
+    SECTION("parse stream")
+    {
+        arena a;
+        std::istringstream is(input);
+        arena_json j = arena_json::parse(a, is);
+        CHECK(j.at("foo").at(0).at("false").as<bool>() == false);
+    }
+
+    SECTION("parse with allocator_set")
+    {
+        arena a;
+        auto alloc_set = combine_allocators(scoped_arena_allocator<char>(arena_allocator<char>(a)));
+        arena_json j = arena_json::parse(alloc_set, input);
+        CHECK(j.at("foo").size() == 1);
+    }
+
+    SECTION("parse wide")
+    {
+        arena a;
+        arena_wjson j = arena_wjson::parse(a, L"{\"a\":[1,2,\"a string longer than short\"]}");
+        CHECK(j.at(L"a").size() == 3);
+        CHECK(j.at(L"a").at(2).as_string_view() == L"a string longer than short");
+    }
+}
+
+TEST_CASE("arena_json modify")
+{
+    arena a;
+    arena_json j = arena_json::parse(a, R"({"a":[1,2,3],"b":"a long string value for the arena"})");
+
+    j["c"] = "another long string value for the arena";
+    j["a"].push_back(4);
+    j["b"] = 5;
+    j.erase("a");
+
+    CHECK(j.size() == 2);
+    CHECK(j.at("b") == 5);
+    CHECK(j.at("c").as_string_view() == "another long string value for the arena");
+
+    arena_json copy = j;
+    CHECK(copy == j);
+
+    arena_json moved = std::move(copy);
+    CHECK(moved == j);
+
+    json other = json::parse(j.to_string());
+    CHECK(other.at("c").as_string_view() == "another long string value for the arena");
+}
+
+TEST_CASE("arena_json outlived by arena")
+{
+    arena a;
+    {
+        std::string input = "[";
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            if (i > 0)
+            {
+                input.push_back(',');
+            }
+            input.append(R"({"key":"value that is too long for a short string","n":[1,2,3]})");
+        }
+        input.push_back(']');
+
+        arena_json j = arena_json::parse(a, input);
+        CHECK(j.size() == 1000);
+    }
+    CHECK(a.capacity() > 0);
+    a.release();
+    CHECK(a.capacity() == 0);
+}
+
+#endif
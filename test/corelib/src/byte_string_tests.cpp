@@ -6,6 +6,7 @@
 #include <sstream>
 #include <vector>
 #include <map>
+#include <list>
 #include <utility>
 #include <ctime>
 #include <new>
@@ -230,3 +231,184 @@ TEST_CASE("byte_string_view iterators")
     }
 }
 
+
+namespace {
+
+    std::string reference_base64(const std::vector<uint8_t>& input, const char* alphabet, bool padded)
+    {
+        std::string s;
+        std::size_t i = 0;
+        for (; i + 3 <= input.size(); i += 3)
+        {
+            uint32_t v = (uint32_t(input[i]) << 16) | (uint32_t(input[i+1]) << 8) | input[i+2];
+            for (int shift = 18; shift >= 0; shift -= 6)
+            {
+                s.push_back(alphabet[(v >> shift) & 0x3f]);
+            }
+        }
+        std::size_t rest = input.size() - i;
+        if (rest > 0)
+        {
+            uint32_t v = uint32_t(input[i]) << 16;
+            if (rest == 2)
+            {
+                v |= uint32_t(input[i+1]) << 8;
+            }
+            for (std::size_t k = 0; k <= rest; ++k)
+            {
+                s.push_back(alphabet[(v >> (18 - 6*k)) & 0x3f]);
+            }
+            if (padded)
+            {
+                s.append(3 - rest, '=');
+            }
+        }
+        return s;
+    }
+
+    std::vector<uint8_t> make_bytes(std::size_t length, unsigned seed)
+    {
+        std::vector<uint8_t> v;
+        uint32_t x = seed * 2654435761u + 1;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            x = x * 1103515245u + 12345u;
+            v.push_back(static_cast<uint8_t>(x >> 16));
+        }
+        return v;
+    }
+
+} // namespace
+
+TEST_CASE("base64 codecs across block boundaries")
+{
+    const char* b64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const char* b64url = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    SECTION("round trip")
+    {
+        for (std::size_t length = 0; length < 200; ++length)
+        {
+            std::vector<uint8_t> input = make_bytes(length, static_cast<unsigned>(length));
+            std::string expected = reference_base64(input, b64, true);
+            std::string expected_url = reference_base64(input, b64url, false);
+
+            std::string s;
+            CHECK(encode_base64(input.data(), input.data() + input.size(), s) == expected.size());
+            CHECK(s == expected);
+
+            std::string s_url = "prefix";
+            CHECK(encode_base64url(input.data(), input.data() + input.size(), s_url) == expected_url.size());
+            CHECK(s_url == "prefix" + expected_url);
+
+            std::string s_it;
+            encode_base64(input.begin(), input.end(), s_it);
+            CHECK(s_it == expected);
+
+            std::wstring ws;
+            encode_base64(input.data(), input.data() + input.size(), ws);
+            CHECK(ws == std::wstring(expected.begin(), expected.end()));
+
+            std::vector<uint8_t> decoded;
+            auto r1 = decode_base64(s.data(), s.data() + s.size(), decoded);
+            CHECK(r1.ec == conv_errc::success);
+            CHECK(decoded == input);
+
+            std::vector<uint8_t> decoded_url;
+            auto r2 = decode_base64url(expected_url.begin(), expected_url.end(), decoded_url);
+            CHECK(r2.ec == conv_errc::success);
+            CHECK(decoded_url == input);
+
+            std::list<char> chars(expected.begin(), expected.end());
+            std::vector<uint8_t> decoded_list;
+            auto r3 = decode_base64(chars.begin(), chars.end(), decoded_list);
+            CHECK(r3.ec == conv_errc::success);
+            CHECK(decoded_list == input);
+
+            std::vector<uint8_t> decoded_wide;
+            auto r4 = decode_base64(ws.begin(), ws.end(), decoded_wide);
+            CHECK(r4.ec == conv_errc::success);
+            CHECK(decoded_wide == input);
+        }
+    }
+
+    SECTION("invalid character")
+    {
+        std::vector<uint8_t> input = make_bytes(96, 7);
+        std::string encoded = reference_base64(input, b64, true);
+        for (std::size_t pos = 0; pos < encoded.size(); ++pos)
+        {
+            std::string s = encoded;
+            s[pos] = (pos % 2 == 0) ? '-' : '\x80';
+
+            std::vector<uint8_t> decoded;
+            auto r = decode_base64(s.data(), s.data() + s.size(), decoded);
+            CHECK(r.ec == conv_errc::not_base64);
+            CHECK(r.it == s.data() + pos);
+            CHECK(decoded == std::vector<uint8_t>(input.begin(), input.begin() + pos / 4 * 3));
+
+            std::list<char> chars(s.begin(), s.end());
+            std::vector<uint8_t> decoded_list;
+            auto r_list = decode_base64(chars.begin(), chars.end(), decoded_list);
+            CHECK(r_list.ec == conv_errc::not_base64);
+            CHECK(std::distance(chars.begin(), r_list.it) == static_cast<std::ptrdiff_t>(pos));
+            CHECK(decoded_list == decoded);
+        }
+    }
+
+    SECTION("padding ends the input")
+    {
+        std::string s = "Zm9vYmFy" "Zm9vYmFy" "Zm9vYmFy" "Zm9vYg==" "ignored";
+        std::vector<uint8_t> decoded;
+        auto r = decode_base64(s.begin(), s.end(), decoded);
+        CHECK(r.ec == conv_errc::success);
+        CHECK(std::string(decoded.begin(), decoded.end()) == "foobarfoobarfoobarfoob");
+    }
+}
+
+TEST_CASE("base16 codecs across block boundaries")
+{
+    for (std::size_t length = 0; length < 100; ++length)
+    {
+        std::vector<uint8_t> input = make_bytes(length, static_cast<unsigned>(length) + 1000);
+        std::string expected;
+        for (uint8_t c : input)
+        {
+            expected.push_back("0123456789ABCDEF"[c >> 4]);
+            expected.push_back("0123456789ABCDEF"[c & 0xf]);
+        }
+
+        std::string s;
+        CHECK(encode_base16(input.data(), input.data() + input.size(), s) == expected.size());
+        CHECK(s == expected);
+
+        std::string s_it;
+        encode_base16(input.begin(), input.end(), s_it);
+        CHECK(s_it == expected);
+
+        std::wstring ws;
+        encode_base16(input.data(), input.data() + input.size(), ws);
+        CHECK(ws == std::wstring(expected.begin(), expected.end()));
+
+        std::string lower = expected;
+        for (auto& c : lower)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        std::vector<uint8_t> decoded;
+        auto r = decode_base16(lower.begin(), lower.end(), decoded);
+        CHECK(r.ec == conv_errc::success);
+        CHECK(decoded == input);
+
+        for (std::size_t pos = 0; pos < expected.size(); pos += 3)
+        {
+            std::string bad = expected;
+            bad[pos] = (pos % 2 == 0) ? 'g' : '/';
+            std::vector<uint8_t> partial;
+            auto rb = decode_base16(bad.data(), bad.data() + bad.size(), partial);
+            CHECK(rb.ec == conv_errc::not_base16);
+            CHECK(rb.it == bad.data());
+            CHECK(partial == std::vector<uint8_t>(input.begin(), input.begin() + pos / 2));
+        }
+    }
+}
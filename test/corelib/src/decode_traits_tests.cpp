@@ -9,6 +9,66 @@
 
 using namespace jsoncons;
 
+namespace decode_traits_tests {
+
+    struct author
+    {
+        std::string name;
+        std::vector<std::string> aliases;
+    };
+
+    struct book
+    {
+        std::string title;
+        author writer;
+        double price;
+        std::vector<author> editors;
+    };
+
+    class chapter
+    {
+        std::string title_;
+        int pages_;
+    public:
+        chapter(const std::string& title, int pages)
+            : title_(title), pages_(pages)
+        {
+        }
+        const std::string& title() const {return title_;}
+        int pages() const {return pages_;}
+    };
+
+    struct volume
+    {
+        std::string name;
+        std::vector<chapter> chapters;
+    };
+
+    struct rating
+    {
+        int stars;
+        std::string comment;
+    };
+
+    template <class T>
+    struct tagged
+    {
+        std::string tag;
+        T value;
+    };
+
+} // namespace decode_traits_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::author, name, aliases)
+JSONCONS_N_MEMBER_TRAITS(decode_traits_tests::book, 2, title, writer, price, editors)
+JSONCONS_ALL_CTOR_GETTER_TRAITS(decode_traits_tests::chapter, title, pages)
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::volume, name, chapters)
+JSONCONS_N_MEMBER_NAME_TRAITS(decode_traits_tests::rating, 1,
+    (stars, "Stars", JSONCONS_RDWR, [](int stars) noexcept {return stars >= 1 && stars <= 5;}),
+    (comment, "Comment")
+)
+JSONCONS_TPL_ALL_MEMBER_TRAITS(1, decode_traits_tests::tagged, tag, value)
+
 TEST_CASE("decode_traits primitive")
 {
     SECTION("is_primitive")
@@ -149,3 +209,207 @@ TEST_CASE("decode_traits deserialization errors")
         CHECK(ec == json_errc::expected_comma_or_rbrace);
     }
 }
+
+TEST_CASE("decode_traits JSONCONS_*_TRAITS")
+{
+    SECTION("nested members, unknown keys and optional members")
+    {
+        std::string input = R"(
+{
+    "unknown" : {"a" : [1, {"b" : null}], "c" : "d"},
+    "title" : "Pulp",
+    "writer" : {"name" : "Charles Bukowski", "aliases" : ["Hank"], "age" : 73},
+    "editors" : [{"name" : "John Martin", "aliases" : []}],
+    "more" : [[], {}]
+}
+        )";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_string_cursor cursor(input);
+        auto val = decode_traits<decode_traits_tests::book,char>::decode(cursor,decoder,ec);
+        REQUIRE_FALSE(ec);
+        CHECK_FALSE(decoder.is_valid()); // no intermediate basic_json
+        cursor.next(ec);
+        CHECK(cursor.done());
+
+        CHECK(val.title == "Pulp");
+        CHECK(val.writer.name == "Charles Bukowski");
+        REQUIRE(val.writer.aliases.size() == 1);
+        CHECK(val.writer.aliases[0] == "Hank");
+        CHECK(val.price == 0);
+        REQUIRE(val.editors.size() == 1);
+        CHECK(val.editors[0].name == "John Martin");
+
+        auto expected = json::parse(input).as<decode_traits_tests::book>();
+        CHECK(json(val) == json(expected));
+    }
+
+    SECTION("missing mandatory member")
+    {
+        std::string input = R"({"title" : "Pulp", "price" : 10.5})";
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::book>(input), conv_error);
+        REQUIRE_THROWS_AS(json::parse(input).as<decode_traits_tests::book>(), conv_error);
+    }
+
+    SECTION("not an object")
+    {
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::author>(std::string(R"(["name"])")), conv_error);
+
+        std::string input = R"([{"name" : "Ann", "unknown" : [1, {"a" : []}], "aliases" : []}, [["name"], {}], {"name" : "Bob", "aliases" : ["B"]}])";
+        json_string_cursor cursor(input);
+        auto view = staj_array<decode_traits_tests::author>(cursor);
+
+        std::vector<std::string> names;
+        std::size_t count = 0;
+        for (auto it = view.begin(); it != view.end(); ++it, ++count)
+        {
+            if (it.has_value())
+            {
+                names.push_back(it->name);
+            }
+        }
+        CHECK(count == 3);
+        REQUIRE(names.size() == 2);
+        CHECK(names[0] == "Ann");
+        CHECK(names[1] == "Bob");
+    }
+
+    SECTION("member of the wrong type")
+    {
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::author>(std::string(R"({"name" : "Ann", "aliases" : 1})")), conv_error);
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::book>(std::string(R"({"title" : "Pulp", "writer" : {"name" : "Ann", "aliases" : [1, {}]}})")), conv_error);
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::chapter>(std::string(R"({"title" : "One", "pages" : [12]})")), conv_error);
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::rating>(std::string(R"({"Stars" : "four"})")), conv_error);
+
+        std::string input = R"([{"name" : "Ann", "aliases" : []}, {"name" : "Cy", "aliases" : 7}, {"name" : "Di", "aliases" : true, "other" : [1]}, {"name" : "Bob", "aliases" : ["B"]}])";
+        json_string_cursor cursor(input);
+        auto view = staj_array<decode_traits_tests::author>(cursor);
+
+        std::vector<std::string> names;
+        std::size_t count = 0;
+        for (auto it = view.begin(); it != view.end(); ++it, ++count)
+        {
+            if (it.has_value())
+            {
+                names.push_back(it->name);
+            }
+        }
+        CHECK(count == 4);
+        REQUIRE(names.size() == 2);
+        CHECK(names[0] == "Ann");
+        CHECK(names[1] == "Bob");
+    }
+
+    SECTION("struct in a container member that fails to convert")
+    {
+        std::string input = R"({"title" : "Pulp", "writer" : {"name" : "Ann", "aliases" : []}, "editors" : [{"name" : "A", "aliases" : []}, {"x" : 2}, {"name" : "C", "aliases" : []}], "price" : 4})";
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::book>(input), conv_error);
+        REQUIRE_THROWS_AS(json::parse(input).as<decode_traits_tests::book>(), conv_error);
+    }
+
+    SECTION("repeated member")
+    {
+        std::string input = R"({"name" : "First", "aliases" : ["A"], "name" : "Second", "aliases" : 1})";
+        auto val = decode_json<decode_traits_tests::author>(input);
+        auto expected = json::parse(input).as<decode_traits_tests::author>();
+        CHECK(val.name == expected.name);
+        CHECK(val.aliases == expected.aliases);
+        CHECK(val.name == "First");
+    }
+
+    SECTION("ctor getter")
+    {
+        std::string input = R"({"name" : "First", "chapters" : [{"pages" : 12, "title" : "One"}, {"title" : "Two", "pages" : 7, "notes" : [1,2]}]})";
+        auto val = decode_json<decode_traits_tests::volume>(input);
+
+        CHECK(val.name == "First");
+        REQUIRE(val.chapters.size() == 2);
+        CHECK(val.chapters[0].title() == "One");
+        CHECK(val.chapters[0].pages() == 12);
+        CHECK(val.chapters[1].title() == "Two");
+        CHECK(val.chapters[1].pages() == 7);
+
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::chapter>(std::string(R"({"title" : "One"})")), conv_error);
+    }
+
+    SECTION("member names with match")
+    {
+        auto val = decode_json<decode_traits_tests::rating>(std::string(R"({"Comment" : "Good", "Stars" : 4})"));
+        CHECK(val.stars == 4);
+        CHECK(val.comment == "Good");
+
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::rating>(std::string(R"({"Stars" : 6})")), conv_error);
+        REQUIRE_THROWS_AS(decode_json<decode_traits_tests::rating>(std::string(R"({"Comment" : "Good"})")), conv_error);
+    }
+
+    SECTION("template")
+    {
+        auto val = decode_json<std::vector<decode_traits_tests::tagged<decode_traits_tests::author>>>(
+            std::string(R"([{"tag" : "a", "value" : {"name" : "Ann", "aliases" : ["A"]}}])"));
+        REQUIRE(val.size() == 1);
+        CHECK(val[0].tag == "a");
+        CHECK(val[0].value.name == "Ann");
+    }
+
+    SECTION("syntax error")
+    {
+        std::string input = R"({"name" : "Ann", "aliases" : ["A" "B"]})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_string_cursor cursor(input);
+        decode_traits<decode_traits_tests::author,char>::decode(cursor,decoder,ec);
+        CHECK(ec == json_errc::expected_comma_or_rbracket);
+    }
+}
+
+TEST_CASE("json_traits_member_index")
+{
+    SECTION("similar names")
+    {
+        static const jsoncons::string_view names[] = {"id","ids","di","field1","field2","field10","field20","","x"};
+        jsoncons::json_traits_member_index<char,9> index(names);
+
+        for (std::size_t i = 0; i < 9; ++i)
+        {
+            CHECK(index.find(names[i]) == i);
+        }
+        CHECK(index.find("field3") == 9);
+        CHECK(index.find("i") == 9);
+        CHECK(index.find("idss") == 9);
+    }
+
+    SECTION("duplicate names")
+    {
+        static const jsoncons::wstring_view names[] = {L"a",L"b",L"a"};
+        jsoncons::json_traits_member_index<wchar_t,3> index(names);
+
+        CHECK(index.find(L"a") == 0);
+        CHECK(index.find(L"b") == 1);
+        CHECK(index.find(L"c") == 3);
+    }
+
+    SECTION("many names")
+    {
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < 70; ++i)
+        {
+            strings.push_back("member" + std::to_string(i));
+        }
+        jsoncons::string_view names[70];
+        for (std::size_t i = 0; i < 70; ++i)
+        {
+            names[i] = strings[i];
+        }
+        jsoncons::json_traits_member_index<char,70> index(names);
+
+        for (std::size_t i = 0; i < 70; ++i)
+        {
+            CHECK(index.find(names[i]) == i);
+        }
+        CHECK(index.find("member70") == 70);
+    }
+}
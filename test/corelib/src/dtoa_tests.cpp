@@ -6,6 +6,8 @@
 #include <catch/catch.hpp>
 #include <iostream>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
 
 using namespace jsoncons;
 
@@ -56,7 +58,7 @@ static void check_dtoa(double x, const std::vector<std::string>& expected)
     check_safe_dtoa(x,expected);
 }
 
-TEST_CASE("test grisu3")
+TEST_CASE("test dtoa_general formatting")
 {
     check_dtoa(1.0e100, {"1e+100"});
     check_dtoa(1.0e-100, {"1e-100"});
@@ -98,3 +100,54 @@ TEST_CASE("test grisu3")
     check_dtoa(0.000071, {"7.1e-05"}); 
 }
 
+
+TEST_CASE("test dtoa_general shortest")
+{
+    // The snprintf based conversion is not shortest for subnormals
+    check_dtoa(5e-324, {"5e-324", "4.94065645841247e-324"});
+    check_dtoa(1e-323, {"1e-323", "9.88131291682493e-324"});
+    check_dtoa(2.2250738585072014e-308, {"2.2250738585072014e-308"});
+    check_dtoa(1.7976931348623157e308, {"1.7976931348623157e+308"});
+    check_dtoa(9007199254740992.0, {"9007199254740992.0"});
+    check_dtoa(0.3, {"0.3"});
+    check_dtoa(0.30000000000000004, {"0.30000000000000004"});
+    check_dtoa(1e23, {"1e+23"});
+    check_dtoa(123456789012345680.0, {"1.2345678901234568e+17"});
+}
+
+TEST_CASE("test dtoa_general round trip")
+{
+    jsoncons::detail::chars_to to_double;
+
+    uint64_t bits = 0x9E3779B97F4A7C15;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        bits = bits*6364136223846793005 + 1442695040888963407;
+        double x;
+        std::memcpy(&x, &bits, sizeof(double));
+        if (!std::isfinite(x))
+        {
+            continue;
+        }
+        std::string s;
+        REQUIRE(jsoncons::detail::dtoa_general(x, '.', s));
+        INFO(s);
+        CHECK(to_double(s.c_str(), s.length()) == x);
+    }
+}
+
+TEST_CASE("test dtoa_fixed and dtoa_scientific")
+{
+    std::string s;
+    jsoncons::detail::dtoa_fixed(1.0e20, '.', s);
+    CHECK(s == "100000000000000000000.0");
+    s.clear();
+    jsoncons::detail::dtoa_fixed(-0.00012, '.', s);
+    CHECK(s == "-0.00012");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(1234.5, '.', s);
+    CHECK(s == "1.2345e+03");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(0.1, '.', s);
+    CHECK(s == "1e-01");
+}
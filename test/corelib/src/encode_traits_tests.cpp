@@ -10,6 +10,7 @@
 
 using jsoncons::json_type_traits;
 using jsoncons::json;
+using jsoncons::ojson;
 using jsoncons::wjson;
 using jsoncons::decode_json;
 using jsoncons::encode_json;
@@ -31,11 +32,64 @@ namespace encode_traits_tests {
         {
         }
     };
+
+    struct shelf
+    {
+        std::string name;
+        std::vector<book> books;
+        std::shared_ptr<std::string> location;
+        jsoncons::optional<int> capacity;
+        std::map<std::string,int> counts;
+    };
+
+    class label
+    {
+        std::string text_;
+        jsoncons::optional<double> weight_;
+    public:
+        label(const std::string& text, const jsoncons::optional<double>& weight)
+            : text_(text), weight_(weight)
+        {
+        }
+        const std::string& text() const {return text_;}
+        const jsoncons::optional<double>& weight() const {return weight_;}
+    };
+
+    struct reading
+    {
+        std::string unit;
+        double value;
+        std::unique_ptr<std::string> note;
+    };
+
+    template <class Json,class T>
+    std::string encode_direct(const T& val)
+    {
+        std::string s;
+        jsoncons::compact_json_string_encoder encoder(s);
+        std::error_code ec;
+        jsoncons::encode_traits<T,char>::encode(val, encoder, Json(), ec);
+        CHECK_FALSE(ec);
+        encoder.flush();
+        return s;
+    }
+
+    template <class Json,class T>
+    std::string encode_dom(const T& val)
+    {
+        std::string s;
+        Json(val).dump(s);
+        return s;
+    }
 } // namespace encode_traits_tests
 
 namespace ns = encode_traits_tests;
 
 JSONCONS_ALL_MEMBER_TRAITS(ns::book,author,title,price)
+JSONCONS_N_MEMBER_TRAITS(ns::shelf,2,name,books,location,capacity,counts)
+JSONCONS_N_CTOR_GETTER_TRAITS(ns::label,1,text,weight)
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::reading,1,(value,"Value"),(unit,"Unit"),
+                              (note,"Note",JSONCONS_RDWR,jsoncons::always_true(),jsoncons::identity()))
 
 TEST_CASE("decode_traits string tests")
 {
@@ -130,3 +184,62 @@ TEST_CASE("decode_traits std::pair tests")
     }
 }
 
+
+TEST_CASE("encode_traits JSONCONS_*_TRAITS")
+{
+    SECTION("members")
+    {
+        ns::shelf val;
+        val.name = "fiction";
+        val.books.emplace_back("Haruki Murakami","Kafka on the Shore",25.17);
+        val.books.emplace_back("Charles Bukowski","Pulp",22.48);
+        val.capacity = 10;
+        val.counts = {{"b",2},{"a",1}};
+
+        CHECK(ns::encode_direct<json>(val) == ns::encode_dom<json>(val));
+        CHECK(ns::encode_direct<ojson>(val) == ns::encode_dom<ojson>(val));
+        CHECK(ns::encode_direct<json>(val).find("location") == std::string::npos);
+
+        val.location = std::make_shared<std::string>("upstairs");
+        val.capacity = jsoncons::optional<int>();
+        CHECK(ns::encode_direct<json>(val) == ns::encode_dom<json>(val));
+        CHECK(ns::encode_direct<ojson>(val) == ns::encode_dom<ojson>(val));
+    }
+    SECTION("ctor getters")
+    {
+        ns::label val1("sale", jsoncons::optional<double>());
+        CHECK(ns::encode_direct<json>(val1) == ns::encode_dom<json>(val1));
+
+        ns::label val2("sale", 0.5);
+        CHECK(ns::encode_direct<json>(val2) == ns::encode_dom<json>(val2));
+        CHECK(ns::encode_direct<ojson>(val2) == ns::encode_dom<ojson>(val2));
+    }
+    SECTION("names")
+    {
+        ns::reading val;
+        val.unit = "kg";
+        val.value = 1.5;
+        CHECK(ns::encode_direct<json>(val) == ns::encode_dom<json>(val));
+        CHECK(ns::encode_direct<ojson>(val) == std::string(R"({"Value":1.5,"Unit":"kg"})"));
+
+        val.note = jsoncons::make_unique<std::string>("approx");
+        CHECK(ns::encode_direct<json>(val) == ns::encode_dom<json>(val));
+        CHECK(ns::encode_direct<ojson>(val) == ns::encode_dom<ojson>(val));
+    }
+    SECTION("encode_json")
+    {
+        std::vector<ns::book> books = {{"Haruki Murakami","Kafka on the Shore",25.17},{"Charles Bukowski","Pulp",22.48}};
+
+        std::string s;
+        encode_json(books, s, jsoncons::indenting::indent);
+        std::string expected;
+        json(books).dump(expected, jsoncons::indenting::indent);
+        CHECK(s == expected);
+
+        std::wstring ws;
+        encode_json(books, ws);
+        std::wstring wexpected;
+        wjson(books).dump(wexpected);
+        CHECK(ws == wexpected);
+    }
+}
@@ -0,0 +1,234 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("basic_interned_key tests")
+{
+    key_intern_table keys;
+
+    SECTION("equal text shares one string")
+    {
+        auto a = keys.intern("name");
+        auto b = keys.make_key("name", 4);
+        auto c = keys.intern("other");
+        CHECK(keys.size() == 2);
+        CHECK(a.data() == b.data());
+        CHECK(a == b);
+        CHECK(a != c);
+        CHECK(a < c);
+        CHECK(a == "name");
+        CHECK(a.size() == 4);
+        CHECK(std::string(a.begin(), a.end()) == "name");
+    }
+
+    SECTION("keys outlive the table")
+    {
+        key_intern_table::key_type a;
+        {
+            key_intern_table other;
+            a = other.intern("name");
+        }
+        CHECK(a == "name");
+        CHECK(a == keys.intern("name"));
+    }
+
+    SECTION("clear")
+    {
+        auto a = keys.intern("name");
+        keys.clear();
+        CHECK(keys.size() == 0);
+        auto b = keys.intern("name");
+        CHECK(a.data() != b.data());
+        CHECK(a == b);
+    }
+
+    SECTION("move")
+    {
+        auto a = keys.intern("name");
+        key_intern_table other(std::move(keys));
+        CHECK(keys.size() == 0);
+        CHECK(other.size() == 1);
+        auto b = other.intern("name");
+        CHECK(a.data() == b.data());
+        CHECK(a != other.intern("other"));
+
+        keys = std::move(other);
+        CHECK(other.size() == 0);
+        CHECK(keys.size() == 2);
+        CHECK(keys.intern("other").data() != a.data());
+        CHECK(keys.intern("name").data() == a.data());
+    }
+
+    SECTION("uninterned keys")
+    {
+        interned_key a("name");
+        interned_key b(std::string("name").data(), 4);
+        interned_key empty;
+        CHECK(a.data() != b.data());
+        CHECK(a == b);
+        CHECK(a == keys.intern("name"));
+        CHECK(empty.empty());
+        CHECK(empty == "");
+
+        interned_key copy(a);
+        CHECK(copy.data() == a.data());
+        interned_key moved(std::move(copy));
+        CHECK(moved.data() == a.data());
+        CHECK(copy.empty());
+
+        std::ostringstream os;
+        os << a;
+        CHECK(os.str() == "name");
+    }
+
+    SECTION("many keys")
+    {
+        std::vector<interned_key> v;
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(keys.intern(std::to_string(i)));
+        }
+        CHECK(keys.size() == 1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto k = keys.intern(std::to_string(i));
+            CHECK(k.data() == v[i].data());
+        }
+        CHECK(keys.size() == 1000);
+    }
+}
+
+TEST_CASE("interned_json parse")
+{
+    std::string s = R"([{"id":1,"name":"a"},{"id":2,"name":"b"},{"name":"c","id":3}])";
+
+    SECTION("repeated keys share strings")
+    {
+        interned_json j = interned_json::parse(s);
+        REQUIRE(j.size() == 3);
+        const char* id = j[0].object_range().begin()->key().data();
+        for (const auto& item : j.array_range())
+        {
+            CHECK(item.find("id")->key().data() == id);
+        }
+        CHECK(j[2].at("id") == 3);
+        CHECK(j.to_string() == R"([{"id":1,"name":"a"},{"id":2,"name":"b"},{"id":3,"name":"c"}])");
+        CHECK(json::parse(j.to_string()) == json::parse(s));
+    }
+
+    SECTION("order preserving")
+    {
+        interned_ojson j = interned_ojson::parse(s);
+        CHECK(j.to_string() == s);
+        CHECK(j[0].object_range().begin()->key().data() == j[1].object_range().begin()->key().data());
+        CHECK(j[2].object_range().begin()->key().data() == (j[0].object_range().begin()+1)->key().data());
+    }
+
+    SECTION("object operations")
+    {
+        interned_json j = interned_json::parse(s);
+        interned_json& o = j[0];
+        o.insert_or_assign("tag", "x");
+        o.try_emplace("id", 7);
+        CHECK(o.at("id") == 1);
+        CHECK(o.contains("tag"));
+        o.erase("name");
+        CHECK_FALSE(o.contains("name"));
+        o["extra"] = true;
+        CHECK(o.to_string() == R"({"extra":true,"id":1,"tag":"x"})");
+
+        interned_json copy(j);
+        CHECK(copy == j);
+        interned_json other = interned_json::parse(s);
+        CHECK(other != j);
+        other[0] = o;
+        CHECK(other == j);
+    }
+}
+
+TEST_CASE("interned_json shared key table")
+{
+    key_intern_table keys;
+
+    json_decoder<interned_json> decoder1(keys);
+    json_reader reader1(R"({"first":1,"second":2})", decoder1);
+    reader1.read();
+    interned_json j1 = decoder1.get_result();
+
+    json_decoder<interned_json> decoder2(keys);
+    json_reader reader2(R"({"second":3,"first":4})", decoder2);
+    reader2.read();
+    interned_json j2 = decoder2.get_result();
+
+    CHECK(keys.size() == 2);
+    CHECK(j1.object_range().begin()->key().data() == j2.object_range().begin()->key().data());
+    CHECK(j1.at("second") == 2);
+    CHECK(j2.at("first") == 4);
+}
+
+TEST_CASE("json_decoder move")
+{
+    SECTION("json")
+    {
+        json_decoder<json> decoder;
+        json_decoder<json> decoder2(std::move(decoder));
+        json_reader reader(R"({"first":1,"second":2})", decoder2);
+        reader.read();
+        json_decoder<json> decoder3;
+        decoder3 = std::move(decoder2);
+        CHECK(decoder3.get_result().at("second") == 2);
+    }
+
+    SECTION("interned_json")
+    {
+        json_decoder<interned_json> decoder;
+        json_reader reader1(R"({"first":1,"second":2})", decoder);
+        reader1.read();
+        interned_json j1 = decoder.get_result();
+
+        json_decoder<interned_json> decoder2(std::move(decoder));
+        json_reader reader2(R"({"second":3,"first":4})", decoder2);
+        reader2.read();
+        interned_json j2 = decoder2.get_result();
+
+        CHECK(j1.object_range().begin()->key().data() == j2.object_range().begin()->key().data());
+        CHECK(j2.at("first") == 4);
+    }
+
+    SECTION("shared key table")
+    {
+        key_intern_table keys;
+        json_decoder<interned_json> decoder(keys);
+        json_decoder<interned_json> decoder2(std::move(decoder));
+        json_reader reader(R"({"first":1})", decoder2);
+        reader.read();
+        CHECK(keys.size() == 1);
+        CHECK(decoder2.get_result().at("first") == 1);
+    }
+}
+
+TEST_CASE("interned_json from cbor")
+{
+    ojson expected = ojson::parse(R"([{"x":1.5,"y":true},{"x":2.5,"y":false}])");
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(expected, data);
+
+    interned_ojson j = cbor::decode_cbor<interned_ojson>(data);
+    CHECK(j.to_string() == expected.to_string());
+    CHECK(j[0].object_range().begin()->key().data() == j[1].object_range().begin()->key().data());
+
+    std::vector<uint8_t> data2;
+    cbor::encode_cbor(j, data2);
+    CHECK(data2 == data);
+}
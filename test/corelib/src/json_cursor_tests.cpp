@@ -674,3 +674,190 @@ TEMPLATE_TEST_CASE("json_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    struct event_record
+    {
+        staj_event_type type;
+        std::string value;
+        std::size_t line;
+        std::size_t column;
+
+        friend bool operator==(const event_record& lhs, const event_record& rhs)
+        {
+            return lhs.type == rhs.type && lhs.value == rhs.value && lhs.line == rhs.line && lhs.column == rhs.column;
+        }
+    };
+
+    event_record record_event(const staj_cursor& cursor)
+    {
+        const staj_event& event = cursor.current();
+        std::string value;
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+                value = event.get<std::string>();
+                break;
+            default:
+                break;
+        }
+        return event_record{event.event_type(), value, cursor.context().line(), cursor.context().column()};
+    }
+
+    void check_skip_at_every_container(const std::string& input, std::size_t buffer_size)
+    {
+        std::vector<event_record> events;
+        {
+            json_string_cursor cursor(input);
+            for (; !cursor.done(); cursor.next())
+            {
+                events.push_back(record_event(cursor));
+            }
+        }
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            if (!(events[i].type == staj_event_type::begin_array || events[i].type == staj_event_type::begin_object))
+            {
+                continue;
+            }
+            std::size_t j = i;
+            std::size_t depth = 0;
+            do
+            {
+                if (events[j].type == staj_event_type::begin_array || events[j].type == staj_event_type::begin_object)
+                {
+                    ++depth;
+                }
+                else if (events[j].type == staj_event_type::end_array || events[j].type == staj_event_type::end_object)
+                {
+                    --depth;
+                }
+                ++j;
+            }
+            while (depth > 0);
+
+            std::istringstream is(input);
+            basic_json_cursor<char,stream_source<char>> cursor(stream_source<char>(is, buffer_size));
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                cursor.next();
+            }
+            REQUIRE(cursor.current().event_type() == events[i].type);
+            cursor.skip();
+            if (j == events.size())
+            {
+                CHECK(cursor.done());
+            }
+            else
+            {
+                REQUIRE_FALSE(cursor.done());
+                CHECK(record_event(cursor) == events[j]);
+            }
+        }
+    }
+
+} // namespace
+
+TEST_CASE("json_cursor skip")
+{
+    std::string input = R"({
+    "skipped" : {"a" : "]}", "b" : ["\"[", "\\", {"c" : [1, 2, 3]}], "d" : "]"},
+    "kept" : [true, null, 1.5, -2, "x"],
+    "nested" : [[[[]]], {}, [{"e" : "\\\"}"}]],
+    "crlf" : [1,
+        2,
+        3],
+    "last" : 10
+}
+)";
+    std::string crlf;
+    for (char c : input)
+    {
+        if (c == '\n')
+        {
+            crlf.push_back('\r');
+        }
+        crlf.push_back(c);
+    }
+
+    SECTION("whole buffer")
+    {
+        check_skip_at_every_container(input, 16384);
+        check_skip_at_every_container(crlf, 16384);
+    }
+
+    SECTION("small buffers")
+    {
+        for (std::size_t buffer_size : {1, 2, 3, 7, 64})
+        {
+            check_skip_at_every_container(input, buffer_size);
+            check_skip_at_every_container(crlf, buffer_size);
+        }
+    }
+
+    SECTION("long strings")
+    {
+        std::string s = "[";
+        for (int i = 0; i < 100; ++i)
+        {
+            s.append("\"");
+            s.append(static_cast<std::size_t>(i), '\\');
+            s.append(i % 2 == 0 ? "]\",\n" : "\"]\",\n");
+        }
+        s.append("{\"x\":[{}]}],\n[1]");
+        std::string input2 = "[" + s + "]";
+        check_skip_at_every_container(input2, 16384);
+        check_skip_at_every_container(input2, 5);
+    }
+
+    SECTION("scalar")
+    {
+        json_string_cursor cursor(R"([1,[2],3])");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<int>() == 3);
+    }
+
+    SECTION("unexpected eof")
+    {
+        json_string_cursor cursor(R"({"a":[1,2,3)");
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+
+    SECTION("filter view")
+    {
+        json_string_cursor cursor(R"({"a":[1,2,3],"b":{"c":4},"d":5})");
+        auto view = cursor | [](const staj_event& event, const ser_context&) {return event.event_type() != staj_event_type::key;};
+        view.next();
+        view.skip();
+        CHECK(view.current().event_type() == staj_event_type::begin_object);
+        view.skip();
+        CHECK(view.current().get<int>() == 5);
+    }
+}
+
+TEST_CASE("wjson_cursor skip")
+{
+    std::wstring input = L"{\"a\" : [\"]\\\"\", {\"b\" : 1}],\r\n \"c\" : 2}";
+    wjson_string_cursor cursor(input);
+    cursor.next();
+    cursor.next();
+    cursor.skip();
+    REQUIRE(cursor.current().event_type() == staj_event_type::key);
+    CHECK(cursor.current().get<std::wstring>() == L"c");
+    CHECK(cursor.context().line() == 2);
+    cursor.next();
+    CHECK(cursor.current().get<int>() == 2);
+}
@@ -115,3 +115,67 @@ TEMPLATE_TEST_CASE("test_json_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.string2() == R"(["foo",42])");
 }
+
+TEST_CASE("escape_string runs")
+{
+    struct special
+    {
+        std::string input;
+        std::string escaped;
+        std::string solidus_escaped;
+        std::string non_ascii_escaped;
+    };
+    std::vector<special> specials = {
+        {"\"", "\\\"", "\\\"", "\\\""},
+        {"\\", "\\\\", "\\\\", "\\\\"},
+        {"\n", "\\n", "\\n", "\\n"},
+        {"\x01", "\\u0001", "\\u0001", "\\u0001"},
+        {"\x7f", "\\u007F", "\\u007F", "\\u007F"},
+        {"/", "/", "\\/", "/"},
+        {"\xc3\xa9", "\xc3\xa9", "\xc3\xa9", "\\u00E9"},
+        {"\xf0\x9f\x98\x80", "\xf0\x9f\x98\x80", "\xf0\x9f\x98\x80", "\\uD83D\\uDE00"}
+    };
+
+    const std::string text = "The quick brown fox jumps over the lazy dog 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    for (const auto& item : specials)
+    {
+        for (std::size_t pos = 0; pos <= text.size(); ++pos)
+        {
+            std::string input = text.substr(0, pos) + item.input + text.substr(pos);
+
+            std::string result;
+            string_sink<std::string> sink(result);
+            std::size_t count = jsoncons::detail::escape_string(input.data(), input.size(), false, false, sink);
+            CHECK(result == text.substr(0, pos) + item.escaped + text.substr(pos));
+            CHECK(count == result.size());
+
+            result.clear();
+            jsoncons::detail::escape_string(input.data(), input.size(), false, true, sink);
+            CHECK(result == text.substr(0, pos) + item.solidus_escaped + text.substr(pos));
+
+            result.clear();
+            count = jsoncons::detail::escape_string(input.data(), input.size(), true, false, sink);
+            CHECK(result == text.substr(0, pos) + item.non_ascii_escaped + text.substr(pos));
+            CHECK(count == result.size());
+        }
+    }
+
+    SECTION("encoders")
+    {
+        std::string input = text + "\"/\t" + text + "\xc3\xa9" + text;
+        std::string expected = "\"" + text + "\\\"/\\t" + text + "\xc3\xa9" + text + "\"";
+
+        std::string s1;
+        json_string_encoder encoder1(s1);
+        encoder1.string_value(input);
+        encoder1.flush();
+        CHECK(s1 == expected);
+
+        std::string s2;
+        compact_json_string_encoder encoder2(s2);
+        encoder2.string_value(input);
+        encoder2.flush();
+        CHECK(s2 == expected);
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.append("{\"id\":");
+            s.append(std::to_string(i));
+            s.append(",\"name\":\"item ");
+            s.append(std::to_string(i));
+            s.append("\",\"values\":[1,2,3]}\n");
+        }
+        return s;
+    }
+
+} // namespace
+
+TEST_CASE("json_lines_reader ordered")
+{
+    std::string input = make_lines(1000);
+
+    for (std::size_t num_threads : {1, 2, 4})
+    {
+        std::istringstream is(input);
+        json_lines_reader<json> reader(is, json_options(), 
+                                       json_lines_options().num_threads(num_threads).chunk_size(64));
+        std::vector<std::pair<std::size_t,json>> values;
+        reader.read([&](std::size_t line, json&& j){values.emplace_back(line, std::move(j));});
+
+        REQUIRE(values.size() == 1000);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(values[i].first == i + 1);
+            CHECK(values[i].second.at("id").as<std::size_t>() == i);
+        }
+    }
+}
+
+TEST_CASE("json_lines_reader unordered")
+{
+    std::string input = make_lines(1000);
+    std::istringstream is(input);
+    json_lines_reader<ojson> reader(is, json_options(), 
+                                    json_lines_options().num_threads(4).chunk_size(100).ordered(false));
+    std::vector<std::size_t> lines;
+    reader.read([&](std::size_t line, const ojson& j)
+    {
+        CHECK(j.at("id").as<std::size_t>() + 1 == line);
+        lines.push_back(line);
+    });
+
+    REQUIRE(lines.size() == 1000);
+    std::sort(lines.begin(), lines.end());
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+        CHECK(lines[i] == i + 1);
+    }
+}
+
+TEST_CASE("json_lines_reader line handling")
+{
+    SECTION("blank lines, CRLF, BOM and no final newline")
+    {
+        std::string input = "\xEF\xBB\xBF" "[1]\r\n\r\n  \n{\"a\":\"a string that is longer than the chunk size\"}\r\n2";
+        json_lines_reader<json,string_source<char>> reader(input, json_options(), 
+                                                           json_lines_options().num_threads(2).chunk_size(8));
+        std::vector<std::pair<std::size_t,json>> values;
+        reader.read([&](std::size_t line, json&& j){values.emplace_back(line, std::move(j));});
+
+        REQUIRE(values.size() == 3);
+        CHECK(values[0].first == 1);
+        CHECK(values[0].second == json::parse("[1]"));
+        CHECK(values[1].first == 4);
+        CHECK(values[1].second.at("a").as<std::string>() == "a string that is longer than the chunk size");
+        CHECK(values[2].first == 5);
+        CHECK(values[2].second == 2);
+    }
+
+    SECTION("wide characters")
+    {
+        std::wstring input = L"{\"a\":1}\n{\"a\":2}\n";
+        json_lines_reader<wjson,string_source<wchar_t>> reader(input, basic_json_decode_options<wchar_t>(), json_lines_options().num_threads(2));
+        std::vector<wjson> values;
+        reader.read([&](std::size_t, wjson&& j){values.push_back(std::move(j));});
+
+        REQUIRE(values.size() == 2);
+        CHECK(values[1].at(L"a") == 2);
+    }
+}
+
+TEST_CASE("json_lines_reader errors")
+{
+    std::string input = "{\"a\":1}\n{\"a\":}\n[1,2]\n[1,2] 3\n{\"a\":\n";
+
+    SECTION("error handler")
+    {
+        json_lines_reader<json,string_source<char>> reader(input, json_options(), 
+                                                           json_lines_options().num_threads(2).chunk_size(10));
+        std::vector<std::size_t> value_lines;
+        std::vector<ser_error> errors;
+        reader.read([&](std::size_t line, json&&){value_lines.push_back(line);},
+                    [&](const ser_error& e){errors.push_back(e);});
+
+        CHECK(value_lines == std::vector<std::size_t>{1, 3});
+        REQUIRE(errors.size() == 3);
+        CHECK(errors[0].code() == json_errc::expected_value);
+        CHECK(errors[0].line() == 2);
+        CHECK(errors[0].column() == 6);
+        CHECK(errors[1].code() == json_errc::extra_character);
+        CHECK(errors[1].line() == 4);
+        CHECK(errors[2].code() == json_errc::unexpected_eof);
+        CHECK(errors[2].line() == 5);
+    }
+
+    SECTION("throws")
+    {
+        json_lines_reader<json,string_source<char>> reader(input, json_options(), 
+                                                           json_lines_options().num_threads(2));
+        std::size_t count = 0;
+        REQUIRE_THROWS_AS(reader.read([&](std::size_t, json&&){++count;}), ser_error);
+        CHECK(count == 1);
+    }
+
+    SECTION("exception from callback")
+    {
+        std::string lines = make_lines(1000);
+        json_lines_reader<json,string_source<char>> reader(lines, json_options(), 
+                                                           json_lines_options().num_threads(4).chunk_size(64));
+        REQUIRE_THROWS_AS(reader.read([&](std::size_t line, json&&)
+                                      {
+                                          if (line == 100) 
+                                          {
+                                              throw std::runtime_error("stop");
+                                          }
+                                      }), 
+                          std::runtime_error);
+
+        // Chunks in flight at the time of the exception are dropped, reading resumes after them
+        std::vector<std::size_t> value_lines;
+        reader.read([&](std::size_t line, json&&){value_lines.push_back(line);});
+        REQUIRE_FALSE(value_lines.empty());
+        CHECK(value_lines.front() > 100);
+        CHECK(value_lines.back() == 1000);
+        CHECK(std::is_sorted(value_lines.begin(), value_lines.end()));
+    }
+}
@@ -1175,3 +1175,256 @@ TEST_CASE("test_json_merge_or_update_move")
     }
 }
 
+
+TEST_CASE("json object with key prefix index")
+{
+    // Keys longer than the packed prefix share their first bytes, keys of other lengths do not
+    std::vector<std::string> keys;
+    for (int i = 0; i < 60; ++i)
+    {
+        keys.push_back("long_shared_prefix_" + std::to_string(i));
+        keys.push_back(std::to_string(i*7));
+        keys.push_back(std::string(1, static_cast<char>('A' + i % 26)) + std::to_string(i));
+    }
+    keys.push_back("");
+    keys.push_back("\xC3\xA9t\xC3\xA9");
+
+    json j;
+    std::map<std::string,int> expected;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        j.try_emplace(keys[i], static_cast<int>(i));
+        expected.emplace(keys[i], static_cast<int>(i));
+    }
+
+    auto check = [&](const json& val)
+    {
+        REQUIRE(val.size() == expected.size());
+        for (const auto& item : expected)
+        {
+            auto it = val.find(item.first);
+            REQUIRE((it != val.object_range().end()));
+            CHECK(it->key() == item.first);
+            CHECK(it->value().as<int>() == item.second);
+        }
+        CHECK_FALSE(val.contains("long_shared_prefix_"));
+        CHECK_FALSE(val.contains("long_shared_prefix_999"));
+        CHECK_FALSE(val.contains("long"));
+        CHECK_FALSE(val.contains("zzz"));
+        CHECK(val.as<std::map<std::string,int>>() == expected);
+    };
+
+    SECTION("find")
+    {
+        check(j);
+        const json copy(j);
+        check(copy);
+    }
+
+    SECTION("erase and insert")
+    {
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            j.erase(keys[i]);
+            expected.erase(keys[i]);
+        }
+        check(j);
+
+        j.erase(j.object_range().begin(), j.object_range().begin() + (j.size() - 10));
+        expected = j.as<std::map<std::string,int>>();
+        CHECK(expected.size() == 10);
+        check(j);
+
+        for (std::size_t i = 0; i < keys.size(); i += 3)
+        {
+            j.insert_or_assign(keys[i], -1);
+            expected[keys[i]] = -1;
+        }
+        check(j);
+    }
+
+    SECTION("hints")
+    {
+        json k;
+        auto hint = k.object_range().begin();
+        for (const auto& item : expected)
+        {
+            hint = k.insert_or_assign(hint, item.first, item.second);
+        }
+        check(k);
+    }
+
+    SECTION("parse")
+    {
+        json k = json::parse(j.to_string());
+        check(k);
+        CHECK(k == j);
+    }
+}
+
+namespace {
+
+    bool fail_prefix_allocation = false;
+
+    // Fails to allocate the 16 byte trivial entries of a key prefix index while fail_prefix_allocation is set
+    template <class T>
+    struct prefix_failing_allocator
+    {
+        using value_type = T;
+
+        prefix_failing_allocator() = default;
+
+        template <class U>
+        prefix_failing_allocator(const prefix_failing_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (fail_prefix_allocation && std::is_trivial<T>::value && sizeof(T) == 2*sizeof(uint64_t))
+            {
+                throw std::bad_alloc();
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const prefix_failing_allocator&, const prefix_failing_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const prefix_failing_allocator&, const prefix_failing_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("json insert when the key prefix index fails to allocate")
+{
+    using failing_json = basic_json<char,sorted_policy,prefix_failing_allocator<char>>;
+
+    failing_json doc(json_object_arg);
+    for (std::size_t i = 0; i < 15; ++i)
+    {
+        doc.try_emplace("key" + std::to_string(i), i);
+    }
+
+    fail_prefix_allocation = true;
+    CHECK_NOTHROW(doc.try_emplace("key15", 15));
+    CHECK_NOTHROW(doc.insert_or_assign("key16", 16));
+    fail_prefix_allocation = false;
+
+    CHECK(doc.size() == 17);
+    doc.try_emplace("key17", 17);
+    for (std::size_t i = 0; i < 18; ++i)
+    {
+        CHECK(doc.at("key" + std::to_string(i)).as<std::size_t>() == i);
+    }
+    CHECK_FALSE(doc.contains("key18"));
+}
+
+TEST_CASE("wjson object above the key prefix index threshold")
+{
+    wjson doc(json_object_arg);
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        doc.try_emplace(L"key" + std::to_wstring(i), i);
+    }
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        CHECK(doc.at(L"key" + std::to_wstring(i)).as<std::size_t>() == i);
+    }
+    CHECK_FALSE(doc.contains(L"key40"));
+}
+
+TEST_CASE("json merge and merge_or_update of sorted ranges")
+{
+    json j = json::parse(R"({"b":1,"d":2,"f":3})");
+    json source = json::parse(R"({"a":10,"d":20,"e":30,"g":40})");
+
+    SECTION("merge")
+    {
+        json k = j;
+        k.merge(source);
+        CHECK(k == json::parse(R"({"a":10,"b":1,"d":2,"e":30,"f":3,"g":40})"));
+
+        json m = j;
+        m.merge(json(source));
+        CHECK(m == k);
+    }
+
+    SECTION("merge_or_update")
+    {
+        json k = j;
+        k.merge_or_update(source);
+        CHECK(k == json::parse(R"({"a":10,"b":1,"d":20,"e":30,"f":3,"g":40})"));
+
+        json m = j;
+        m.merge_or_update(json(source));
+        CHECK(m == k);
+    }
+
+    SECTION("merge_or_update a key between members")
+    {
+        json k = json::parse(R"({"c":2})");
+        k.merge_or_update(json::parse(R"({"b":1})"));
+        CHECK(k == json::parse(R"({"b":1,"c":2})"));
+    }
+
+    SECTION("into a large object")
+    {
+        json k;
+        json s;
+        for (int i = 0; i < 100; ++i)
+        {
+            k.try_emplace("key" + std::to_string(2*i), i);
+            s.try_emplace("key" + std::to_string(3*i), -i);
+        }
+        json expected = k;
+        for (const auto& item : s.object_range())
+        {
+            expected.insert_or_assign(item.key(), item.value());
+        }
+        k.merge_or_update(s);
+        CHECK(k == expected);
+        CHECK(k.at("key6") == -2);
+        CHECK(k.at("key297") == -99);
+        CHECK(k.at("key196") == 98);
+    }
+}
+
+TEST_CASE("json insert_or_assign range")
+{
+    std::vector<std::pair<std::string,int>> items = {{"c",1},{"a",2},{"c",3},{"b",4}};
+
+    SECTION("json")
+    {
+        json j = json::parse(R"({"b":0,"d":0})");
+        j.insert_or_assign(items.begin(), items.end());
+        CHECK(j == json::parse(R"({"a":2,"b":4,"c":3,"d":0})"));
+
+        json k;
+        k.insert_or_assign(items.begin(), items.end());
+        CHECK(k == json::parse(R"({"a":2,"b":4,"c":3})"));
+    }
+
+    SECTION("ojson")
+    {
+        ojson j = ojson::parse(R"({"d":0,"b":0})");
+        j.insert_or_assign(items.begin(), items.end());
+        CHECK(j.to_string() == R"({"d":0,"b":4,"c":3,"a":2})");
+    }
+
+    SECTION("not an object")
+    {
+        json j(json_array_arg);
+        CHECK_THROWS(j.insert_or_assign(items.begin(), items.end()));
+    }
+}
@@ -338,3 +338,48 @@ TEST_CASE("test_diagnostics_visitor", "")
         CHECK(os.str() == expected.str());
     }
 }
+
+TEST_CASE("test_parse_indented_input")
+{
+    std::string indent(40, ' ');
+    std::string input = "{\n" + indent + "\"a\" :  [\n" + indent + "\t\t1,\r\n" + indent + indent + "2.5 ,\r" + 
+                        indent + "true\n" + indent + "],\n" + indent + "\"b\"\t:\t\"x\"\n}\n" + indent;
+
+    SECTION("whole input")
+    {
+        json j = json::parse(input);
+        CHECK(j == json::parse(R"({"a":[1,2.5,true],"b":"x"})"));
+    }
+
+    SECTION("chunked input")
+    {
+        for (std::size_t chunk_size = 1; chunk_size < input.size(); chunk_size += 5)
+        {
+            json_decoder<json> decoder;
+            json_parser parser;
+            for (std::size_t pos = 0; pos < input.size(); pos += chunk_size)
+            {
+                std::size_t length = (std::min)(chunk_size, input.size() - pos);
+                parser.update(input.data() + pos, length);
+                parser.parse_some(decoder);
+            }
+            parser.finish_parse(decoder);
+            parser.check_done();
+            REQUIRE(decoder.is_valid());
+            CHECK(decoder.get_result() == json::parse(R"({"a":[1,2.5,true],"b":"x"})"));
+        }
+    }
+
+    SECTION("error position")
+    {
+        std::string bad = "[\n" + indent + "1,\r\n" + indent + indent + "2\n" + indent + "\t3]";
+
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_string_reader reader(bad, decoder);
+        reader.read(ec);
+        CHECK(ec == json_errc::expected_comma_or_rbracket);
+        CHECK(reader.line() == 4);
+        CHECK(reader.column() == indent.size() + 2);
+    }
+}
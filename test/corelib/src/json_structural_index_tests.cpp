@@ -0,0 +1,426 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <catch/catch.hpp>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Records each event with the context it was reported with
+    class event_recorder : public default_json_visitor
+    {
+    public:
+        std::vector<std::string> events;
+    private:
+        void record(const std::string& event, const ser_context& context)
+        {
+            std::ostringstream os;
+            os << event << "@" << context.line() << ":" << context.column() << ":"
+               << context.position() << "-" << context.end_position();
+            events.push_back(os.str());
+        }
+
+        bool visit_begin_object(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("{", context);
+            return true;
+        }
+        bool visit_end_object(const ser_context& context, std::error_code&) override
+        {
+            record("}", context);
+            return true;
+        }
+        bool visit_begin_array(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("[", context);
+            return true;
+        }
+        bool visit_end_array(const ser_context& context, std::error_code&) override
+        {
+            record("]", context);
+            return true;
+        }
+        bool visit_key(const string_view_type& name, const ser_context& context, std::error_code&) override
+        {
+            record("key " + std::string(name), context);
+            return true;
+        }
+        bool visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code&) override
+        {
+            record("string " + std::string(value) + " " + std::to_string(static_cast<int>(tag)), context);
+            return true;
+        }
+        bool visit_int64(int64_t value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("int64 " + std::to_string(value), context);
+            return true;
+        }
+        bool visit_uint64(uint64_t value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("uint64 " + std::to_string(value), context);
+            return true;
+        }
+        bool visit_double(double value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("double " + std::to_string(value), context);
+            return true;
+        }
+        bool visit_bool(bool value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record(value ? "true" : "false", context);
+            return true;
+        }
+        bool visit_null(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("null", context);
+            return true;
+        }
+    };
+
+    struct parse_result
+    {
+        std::vector<std::string> events;
+        std::error_code ec;
+        std::size_t line;
+        std::size_t column;
+    };
+
+    parse_result read_with(const std::string& input, const json_options& options)
+    {
+        parse_result result;
+        event_recorder visitor;
+        json_string_reader reader(input, visitor, options);
+        reader.read(result.ec);
+        result.events = visitor.events;
+        result.line = reader.line();
+        result.column = reader.column();
+        return result;
+    }
+
+    void check_same_as_default(const std::string& input, json_options options = json_options())
+    {
+        parse_result expected = read_with(input, options);
+        options.structural_index(structural_index_kind::all);
+        parse_result actual = read_with(input, options);
+
+        INFO(input);
+        CHECK(actual.events == expected.events);
+        CHECK(actual.ec == expected.ec);
+        CHECK(actual.line == expected.line);
+        CHECK(actual.column == expected.column);
+    }
+
+    // Records each event of a cursor with the context it stopped at
+    template <class Cursor>
+    std::vector<std::string> cursor_positions(Cursor& cursor)
+    {
+        std::vector<std::string> positions;
+        for (; !cursor.done(); cursor.next())
+        {
+            std::ostringstream os;
+            os << cursor.current().event_type() << "@" << cursor.context().line() << ":" << cursor.context().column();
+            positions.push_back(os.str());
+        }
+        return positions;
+    }
+
+} // namespace
+
+TEST_CASE("json structural index tests")
+{
+    SECTION("valid input")
+    {
+        std::vector<std::string> inputs = {
+            R"({})",
+            R"([])",
+            R"("root string")",
+            R"(-12.5e3)",
+            R"(true)",
+            R"({"a":1,"b":-2,"c":3.25,"d":1e10,"e":-0,"f":0.5E-3,"g":true,"h":false,"i":null,"j":"x"})",
+            R"([[[]],[{}],{"":[]}])",
+            "{\n    \"first\" : \"Jane\",\n\t\"last\":\"Roe\" ,\r\n  \"tags\": [ \"a\" , \"b\" ]\r\"n\":[1,2,3]\n}\n",
+            R"({"escaped":"a\"b\\c\/d\b\f\n\r\té😀","after":"plain"})",
+            R"(["\\", "\\\\", "\"", "x\\\"y", "", " "])",
+            R"({"big":18446744073709551616,"neg":-9223372036854775809,"max":18446744073709551615})",
+            "[\"\xce\xb1\xce\xb2\xce\xb3\", \"\xe2\x82\xac\"]",
+            R"([1,[2,[3,[4,[5]]]],{"a":{"b":{"c":{}}}}])"
+        };
+        for (const auto& input : inputs)
+        {
+            check_same_as_default(input);
+        }
+    }
+
+    SECTION("long strings and deep indentation")
+    {
+        std::string text(200, 'x');
+        std::string input = "[\n";
+        for (std::size_t i = 0; i < 50; ++i)
+        {
+            input.append(std::string(i, ' ') + "{\"key" + std::to_string(i) + "\": \"" + text.substr(0, i*3) + "\", \"v\": " + std::to_string(i) + ".5},\n");
+        }
+        input.append("\"" + text + "\\n" + text + "\"\n]");
+        check_same_as_default(input);
+    }
+
+    SECTION("input spanning several index windows")
+    {
+        std::string input = "[";
+        for (std::size_t i = 0; i < 2000; ++i)
+        {
+            if (i > 0)
+            {
+                input.append(i % 3 == 0 ? ",\r\n" : ", ");
+            }
+            input.append("{\"id\":" + std::to_string(i) + ",\"text\":\"" + std::string(i % 97, 'a') +
+                         (i % 5 == 0 ? "\\\"\\\\" : "") + "\",\"list\":[true,false,null," + std::to_string(i) + ".25]}");
+        }
+        input.append("]");
+        check_same_as_default(input);
+    }
+
+    SECTION("invalid input")
+    {
+        std::vector<std::string> inputs = {
+            R"({"a":1,})",
+            R"([1,2,])",
+            R"([1 2])",
+            R"({"a" 1})",
+            R"({"a":01})",
+            R"([truex])",
+            R"([tru])",
+            R"([nul, 1])",
+            R"(["a"b])",
+            R"({"a":"b"}})",
+            R"([1,2]])",
+            R"({"a":[}])",
+            "[\"a\x01b\"]",
+            "[\"a\nb\"]",
+            "[\"\xc3\x28\"]",
+            R"([1.])",
+            R"([1.e5])",
+            R"([-])",
+            R"([1e+])",
+            R"({'a':1})",
+            R"([1,2)",
+            R"({"a":)",
+            R"([0]x)",
+            R"(1 2)",
+            R"(["unterminated)",
+            R"([\"a"])"
+        };
+        for (const auto& input : inputs)
+        {
+            check_same_as_default(input);
+        }
+    }
+
+    SECTION("comments")
+    {
+        std::string input = "{\n  // comment\n  \"a\": [1, /* two */ 2],\n  \"b\": 3\n}";
+        check_same_as_default(input);
+    }
+
+    SECTION("options")
+    {
+        json_options options;
+        options.lossless_number(true);
+        check_same_as_default(R"([1.5, 2e3, -0.25])", options);
+
+        json_options nan_options;
+        nan_options.nan_to_str("NaN");
+        check_same_as_default(R"(["NaN", 1.0])", nan_options);
+
+        json_options depth_options;
+        depth_options.max_nesting_depth(3);
+        check_same_as_default(R"([[[[1]]]])", depth_options);
+    }
+
+    SECTION("files")
+    {
+        std::vector<std::string> paths = {
+            "./corelib/input/address-book.json",
+            "./corelib/input/cyrillic.json",
+            "./corelib/input/locations.json",
+            "./corelib/input/persons.json",
+            "./corelib/input/json-multiline-comment.json"
+        };
+        for (const auto& path : paths)
+        {
+            std::ifstream is(path);
+            REQUIRE(is);
+            std::stringstream buffer;
+            buffer << is.rdbuf();
+            check_same_as_default(buffer.str());
+        }
+    }
+}
+
+TEST_CASE("json structural index with chunked input")
+{
+    std::string input = "{\"records\": [\n";
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        input.append("  {\"id\": " + std::to_string(i) + ", \"name\": \"item\\t" + std::to_string(i) + "\", \"ok\": true},\n");
+    }
+    input.append("  null\n]}");
+
+    json expected = json::parse(input);
+
+    json_options options;
+    options.structural_index(structural_index_kind::all);
+
+    for (std::size_t chunk_size = 7; chunk_size < input.size(); chunk_size += 37)
+    {
+        std::istringstream is(input);
+        json_decoder<json> decoder;
+        json_stream_reader reader(stream_source<char>(is, chunk_size), decoder, options);
+        reader.read();
+        REQUIRE(decoder.is_valid());
+        CHECK(decoder.get_result() == expected);
+    }
+}
+
+TEST_CASE("json structural index with cursor")
+{
+    std::string input = R"({"a":[1,2.5,"three",true,null],"b":{"c":"d"}})";
+
+    json_options options;
+    options.structural_index(structural_index_kind::all);
+
+    json_string_cursor expected_cursor(input);
+    json_string_cursor cursor(input, options);
+    for (; !cursor.done() && !expected_cursor.done(); cursor.next(), expected_cursor.next())
+    {
+        CHECK(cursor.current().event_type() == expected_cursor.current().event_type());
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+                CHECK(cursor.current().get<std::string>() == expected_cursor.current().get<std::string>());
+                break;
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+                CHECK(cursor.current().get<double>() == expected_cursor.current().get<double>());
+                break;
+            default:
+                break;
+        }
+    }
+    CHECK(cursor.done());
+    CHECK(expected_cursor.done());
+}
+
+TEST_CASE("json structural index with multiple values")
+{
+    std::string input = "{\"a\":1}\n[2,3]\n\"four\"\n{\"b\":[true]}\n";
+
+    json_options options;
+    options.structural_index(structural_index_kind::all);
+
+    json_decoder<json> decoder;
+    json_string_reader reader(input, decoder, options);
+
+    std::vector<json> values;
+    while (!reader.eof())
+    {
+        reader.read_next();
+        if (!reader.eof())
+        {
+            REQUIRE(decoder.is_valid());
+            values.push_back(decoder.get_result());
+        }
+    }
+    REQUIRE(values.size() == 4);
+    CHECK(values[0] == json::parse(R"({"a":1})"));
+    CHECK(values[1] == json::parse(R"([2,3])"));
+    CHECK(values[2] == json("four"));
+    CHECK(values[3] == json::parse(R"({"b":[true]})"));
+}
+
+TEST_CASE("json structural index cursor positions")
+{
+    std::vector<std::string> inputs = {
+        "[1,\n2]",
+        "{\"a\":853 \n}",
+        "[1.5,\n-2e3 ,true, null\n]",
+        "{\"a\":1,\"b\":[2]}",
+        "[1\r\n,2\r,3\r\n]",
+        "{\"a\" : 10\t,\n \"b\" : [ 0 , 0.5 ]\n}"
+    };
+
+    json_options options;
+    options.structural_index(structural_index_kind::all);
+
+    SECTION("string cursor")
+    {
+        for (const auto& input : inputs)
+        {
+            json_string_cursor expected_cursor(input);
+            json_string_cursor cursor(input, options);
+
+            INFO(input);
+            CHECK(cursor_positions(cursor) == cursor_positions(expected_cursor));
+        }
+    }
+
+    SECTION("chunked stream cursor")
+    {
+        for (const auto& input : inputs)
+        {
+            for (std::size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+            {
+                std::istringstream expected_is(input);
+                json_stream_cursor expected_cursor(stream_source<char>(expected_is, chunk_size));
+                std::istringstream is(input);
+                json_stream_cursor cursor(stream_source<char>(is, chunk_size), options);
+
+                INFO(input << " chunk size " << chunk_size);
+                CHECK(cursor_positions(cursor) == cursor_positions(expected_cursor));
+            }
+        }
+    }
+}
+
+TEST_CASE("json structural index indented text heuristic")
+{
+    std::string compact = R"({"a":[1,2.5,"three",true,null],"b":{"c":"d"}})";
+    std::ostringstream os;
+    os << pretty_print(json::parse(compact));
+    std::string indented = os.str();
+
+    CHECK_FALSE(jsoncons::detail::is_indented_text(compact.data(), compact.data() + compact.size()));
+    CHECK(jsoncons::detail::is_indented_text(indented.data(), indented.data() + indented.size()));
+    CHECK(jsoncons::detail::is_indented_text(compact.data(), compact.data()));
+}
+
+TEST_CASE("json structural index indented")
+{
+    std::string compact = R"({"a":[1,2.5,"three",true,null],"b":{"c":"d","e":[{"f":-1e3}]}})";
+    std::ostringstream os;
+    os << pretty_print(json::parse(compact));
+    std::string indented = os.str();
+
+    json_options options;
+    options.structural_index(structural_index_kind::indented);
+
+    for (const auto& input : {compact, indented})
+    {
+        parse_result expected = read_with(input, json_options());
+        parse_result actual = read_with(input, options);
+
+        INFO(input);
+        CHECK(actual.events == expected.events);
+        CHECK(actual.ec == expected.ec);
+        CHECK(actual.line == expected.line);
+        CHECK(actual.column == expected.column);
+    }
+}
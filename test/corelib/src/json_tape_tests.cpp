@@ -0,0 +1,267 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_tape.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95}
+    },
+    "counts" : [0, -1, 18446744073709551615, 1e300, true, false, null],
+    "empty object" : {},
+    "empty array" : [],
+    "expensive": 10
+}
+    )";
+
+    // Compares a tape value with the same value in a basic_json, through the accessors only
+    void check_same(const json_tape::const_reference& value, const ojson& expected)
+    {
+        CHECK(value.type() == expected.type());
+        if (expected.is_object())
+        {
+            CHECK(value.size() == expected.size());
+            auto it = expected.object_range().begin();
+            for (const auto& member : value.object_range())
+            {
+                REQUIRE((it != expected.object_range().end()));
+                CHECK(std::string(member.key()) == it->key());
+                check_same(member.value(), it->value());
+                ++it;
+            }
+            CHECK((it == expected.object_range().end()));
+            for (const auto& member : expected.object_range())
+            {
+                CHECK(value.contains(member.key()));
+                check_same(value.at(member.key()), member.value());
+            }
+        }
+        else if (expected.is_array())
+        {
+            CHECK(value.size() == expected.size());
+            std::size_t i = 0;
+            for (const auto& element : value.array_range())
+            {
+                REQUIRE(i < expected.size());
+                check_same(element, expected[i]);
+                ++i;
+            }
+            CHECK(i == expected.size());
+            for (i = 0; i < expected.size(); ++i)
+            {
+                check_same(value[i], expected[i]);
+            }
+        }
+        else
+        {
+            CHECK(value.as<ojson>() == expected);
+        }
+    }
+
+} // namespace
+
+TEST_CASE("json_tape accessors")
+{
+    json_tape tape = json_tape::parse(input);
+
+    SECTION("navigation")
+    {
+        CHECK(tape.at("store").at("book")[1].at("author").as<std::string>() == "Evelyn Waugh");
+        CHECK(tape["store"]["book"][2]["title"].as<string_view>() == "Moby Dick");
+        CHECK(tape["store"]["bicycle"]["price"].as<double>() == 19.95);
+        CHECK(tape["expensive"].as<int>() == 10);
+        CHECK(tape["counts"][1].as<int64_t>() == -1);
+        CHECK(tape["counts"][2].as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+        CHECK(tape["counts"][3].as<double>() == 1e300);
+        CHECK(tape["counts"][4].as<bool>());
+        CHECK(tape["counts"][6].is_null());
+        CHECK(tape["counts"][0].as<std::string>() == "0");
+        CHECK(tape["counts"].as<std::vector<json>>().size() == 7);
+    }
+
+    SECTION("size")
+    {
+        CHECK(tape.size() == 5);
+        CHECK(tape["store"]["book"].size() == 3);
+        CHECK(tape["empty object"].empty());
+        CHECK(tape["empty array"].empty());
+        CHECK(tape["expensive"].size() == 0);
+    }
+
+    SECTION("missing")
+    {
+        CHECK_FALSE(tape.contains("missing"));
+        CHECK_THROWS_AS(tape.at("missing"), key_not_found);
+        CHECK_THROWS_AS(tape["expensive"].at("missing"), not_an_object);
+        CHECK_THROWS_AS(tape["store"]["book"][3], std::out_of_range);
+        CHECK_THROWS(tape["store"][0]);
+        CHECK_THROWS(tape["store"].as<int>());
+        CHECK_THROWS(tape["expensive"].as<bool>());
+    }
+
+    SECTION("whole document")
+    {
+        check_same(tape.root(), ojson::parse(input));
+    }
+}
+
+TEST_CASE("json_tape replay")
+{
+    ojson expected = ojson::parse(input);
+    json_tape tape = json_tape::parse(input);
+
+    SECTION("as basic_json")
+    {
+        CHECK(tape.as<ojson>() == expected);
+        CHECK(tape["store"].as<json>() == json::parse(input).at("store"));
+    }
+
+    SECTION("to encoder")
+    {
+        std::string s1;
+        std::string s2;
+        compact_json_string_encoder encoder(s1);
+        tape.dump(encoder);
+        expected.dump(s2);
+        CHECK(s1 == s2);
+    }
+
+    SECTION("from_json")
+    {
+        json_tape tape2 = json_tape::from_json(expected);
+        CHECK(tape2.as<ojson>() == expected);
+    }
+}
+
+TEST_CASE("json_tape tags and byte strings")
+{
+    json value(json_object_arg);
+    value.try_emplace("bytes", byte_string_arg, std::vector<uint8_t>{1, 2, 3}, semantic_tag::base64);
+    value.try_emplace("big", "18446744073709551616000", semantic_tag::bigint);
+    value.try_emplace("time", 1431027667, semantic_tag::epoch_second);
+    value.try_emplace("half", half_arg, 0x3c00);
+    value.try_emplace("empty", byte_string_arg, std::vector<uint8_t>{});
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(value, data);
+
+    json_tape_decoder decoder;
+    cbor::cbor_bytes_reader reader(data, decoder);
+    reader.read();
+    REQUIRE(decoder.is_valid());
+    json_tape tape = decoder.get_result();
+
+    CHECK(tape["bytes"].is_byte_string());
+    CHECK(tape["bytes"].tag() == semantic_tag::base64);
+    CHECK(tape["big"].tag() == semantic_tag::bigint);
+    CHECK(tape["time"].tag() == semantic_tag::epoch_second);
+    CHECK(tape["half"].is_double());
+    CHECK(tape["half"].as<double>() == 1.0);
+
+    json_decoder<json> jdecoder;
+    tape.dump(jdecoder);
+    CHECK(jdecoder.get_result() == cbor::decode_cbor<json>(data));
+}
+
+TEST_CASE("json_tape_decoder")
+{
+    json_tape_decoder decoder;
+
+    json_string_reader reader1("[1,[2,3],{\"a\":4}]", decoder);
+    reader1.read();
+    REQUIRE(decoder.is_valid());
+    json_tape tape1 = decoder.get_result();
+    CHECK_FALSE(decoder.is_valid());
+
+    json_string_reader reader2("\"abc\"", decoder);
+    reader2.read();
+    REQUIRE(decoder.is_valid());
+    json_tape tape2 = decoder.get_result();
+
+    CHECK(tape1.as<json>() == json::parse("[1,[2,3],{\"a\":4}]"));
+    CHECK(tape1[2]["a"].as<int>() == 4);
+    CHECK(tape2.as<std::string>() == "abc");
+
+    json_tape empty;
+    CHECK(empty.root().is_null());
+
+    CHECK_THROWS_AS(json_tape::parse("[1,2"), ser_error);
+}
+
+TEST_CASE("json_tape memory")
+{
+    std::string text = "[";
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i > 0)
+        {
+            text.push_back(',');
+        }
+        text.append("{\"id\":" + std::to_string(i) + ",\"name\":\"item\",\"tags\":[\"a\",\"b\"],\"price\":1.5}");
+    }
+    text.push_back(']');
+
+    json_tape tape = json_tape::parse(text);
+    CHECK(tape.size() == 1000);
+    CHECK(tape[999]["id"].as<int>() == 999);
+    // 14 words a record: the double takes two, the other values, the keys, and the begin and end
+    // of the containers one each. The characters of the keys are kept once.
+    CHECK(tape.memory_size() <= 1000*(14*sizeof(uint64_t) + 6) + 64);
+}
+
+TEST_CASE("json_tape long strings and large integers")
+{
+    std::string long_string(70000, 'x');
+    json value(json_array_arg);
+    value.push_back(long_string);
+    value.push_back("short");
+    value.push_back(int64_t(1) << 47);
+    value.push_back(-(int64_t(1) << 47));
+    value.push_back(-(int64_t(1) << 47) - 1);
+    value.push_back(uint64_t(1) << 48);
+    value.push_back((uint64_t(1) << 48) - 1);
+    json object(json_object_arg);
+    object.try_emplace(long_string, 1);
+    object.try_emplace("a", 2);
+    value.push_back(object);
+
+    json_tape tape = json_tape::from_json(value);
+    CHECK(tape[0].as<string_view>().size() == 70000);
+    CHECK(tape[1].as<std::string>() == "short");
+    CHECK(tape[2].as<int64_t>() == (int64_t(1) << 47));
+    CHECK(tape[3].as<int64_t>() == -(int64_t(1) << 47));
+    CHECK(tape[4].as<int64_t>() == -(int64_t(1) << 47) - 1);
+    CHECK(tape[5].is_uint64());
+    CHECK(tape[5].as<uint64_t>() == (uint64_t(1) << 48));
+    CHECK(tape[6].as<uint64_t>() == (uint64_t(1) << 48) - 1);
+    CHECK(tape[7].at(long_string).as<int>() == 1);
+    CHECK(tape[7].at("a").as<int>() == 2);
+    CHECK(tape.as<json>() == value);
+}
+
+TEST_CASE("wjson_tape")
+{
+    std::wstring text = LR"({"a" : {"b" : [10, 20, 30]}, "c" : "é"})";
+    wjson_tape tape = wjson_tape::parse(text);
+    CHECK(tape[L"a"][L"b"][1].as<int>() == 20);
+    CHECK(tape[L"c"].as<std::wstring>() == L"é");
+    CHECK(tape.as<wjson>() == wjson::parse(text));
+}
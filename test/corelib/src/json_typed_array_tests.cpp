@@ -0,0 +1,272 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <array>
+#include <forward_list>
+#include <set>
+#include <string>
+#include <tuple>
+#include <valarray>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class T>
+    std::vector<uint8_t> encode_typed_array(const std::vector<T>& v)
+    {
+        std::vector<uint8_t> data;
+        auto options = cbor::cbor_options{}
+            .use_typed_arrays(true);
+        cbor::cbor_bytes_encoder encoder(data, options);
+        encoder.typed_array(span<const T>(v));
+        encoder.flush();
+        return data;
+    }
+
+    template <class Json>
+    Json decode_packed(const std::vector<uint8_t>& data)
+    {
+        json_decoder<Json> decoder;
+        decoder.packed_typed_arrays(true);
+        cbor::cbor_bytes_reader reader(data, decoder);
+        reader.read();
+        return decoder.get_result();
+    }
+
+} // namespace
+
+TEST_CASE("json typed array from cbor")
+{
+    std::vector<float> v = {1.5f, -2.25f, 3.0f, 0.0f};
+    std::vector<uint8_t> data = encode_typed_array(v);
+
+    json j = decode_packed<json>(data);
+    REQUIRE(j.storage_kind() == json_storage_kind::typed_array_value);
+
+    SECTION("not packed by default")
+    {
+        json k = cbor::decode_cbor<json>(data);
+        CHECK(k.storage_kind() == json_storage_kind::array_value);
+        CHECK(k == j);
+    }
+
+    SECTION("accessors")
+    {
+        const json& cj = j;
+        CHECK(cj.is_array());
+        CHECK(cj.type() == json_type::array_value);
+        CHECK(cj.size() == 4);
+        CHECK_FALSE(cj.empty());
+        CHECK_THROWS_AS(cj.at(4), std::out_of_range);
+        CHECK(j.storage_kind() == json_storage_kind::typed_array_value);
+
+        SECTION("const access by reference replaces the typed array with a regular array")
+        {
+            CHECK(cj[1].as<double>() == -2.25);
+            CHECK(j.storage_kind() == json_storage_kind::array_value);
+            CHECK(cj.at(2).as<float>() == 3.0f);
+            std::size_t n = 0;
+            for (const auto& item : cj.array_range())
+            {
+                CHECK(item.as<float>() == v[n]);
+                ++n;
+            }
+            CHECK(n == 4);
+
+            json copy = decode_packed<json>(data);
+            const json& ccopy = copy;
+            CHECK(ccopy.array_range().begin()->as<float>() == 1.5f);
+            CHECK(copy.storage_kind() == json_storage_kind::array_value);
+        }
+
+        // Non-const access replaces the typed array with a regular array
+        std::size_t i = 0;
+        for (const auto& item : j.array_range())
+        {
+            CHECK(item.as<float>() == v[i]);
+            ++i;
+        }
+        CHECK(i == 4);
+        CHECK(j.storage_kind() == json_storage_kind::array_value);
+        CHECK(cj[1].as<double>() == -2.25);
+        CHECK(cj.at(2).as<float>() == 3.0f);
+        CHECK_THROWS_AS(cj.at(4), std::out_of_range);
+    }
+
+    SECTION("as and is")
+    {
+        CHECK(j.is<std::vector<float>>());
+        CHECK(j.as<std::vector<float>>() == v);
+        CHECK_FALSE(j.is<std::vector<std::string>>());
+
+        CHECK(j.is<std::array<float,4>>());
+        CHECK_FALSE(j.is<std::array<float,3>>());
+        CHECK((j.as<std::array<float,4>>() == std::array<float,4>{{1.5f, -2.25f, 3.0f, 0.0f}}));
+
+        CHECK(j.is<std::set<float>>());
+        CHECK((j.as<std::set<float>>() == std::set<float>(v.begin(), v.end())));
+
+        CHECK(j.is<std::forward_list<float>>());
+        CHECK((j.as<std::forward_list<float>>() == std::forward_list<float>(v.begin(), v.end())));
+
+        CHECK(j.is<std::valarray<float>>());
+        CHECK(j.as<std::valarray<float>>()[1] == -2.25f);
+
+        CHECK((j.is<std::tuple<float,double,float,double>>()));
+        CHECK((j.as<std::tuple<float,double,float,double>>() == std::make_tuple(1.5f, -2.25, 3.0f, 0.0)));
+        CHECK(j.storage_kind() == json_storage_kind::typed_array_value);
+    }
+
+    SECTION("compare")
+    {
+        json expected = json::parse("[1.5,-2.25,3.0,0.0]");
+        CHECK(j == expected);
+        CHECK(expected == j);
+        CHECK(j != json::parse("[1.5,-2.25,3.0]"));
+        CHECK(json::parse("[1.5,-2.25,3.0]") < j);
+        CHECK(j < json::parse("[1.5,-2.25,3.0,1.0]"));
+        CHECK(j != json(json_object_arg));
+        CHECK(j == decode_packed<json>(data));
+    }
+
+    SECTION("round trip")
+    {
+        std::vector<uint8_t> data2;
+        auto options = cbor::cbor_options{}
+            .use_typed_arrays(true);
+        cbor::encode_cbor(j, data2, options);
+        CHECK(data2 == data);
+    }
+
+    SECTION("json text")
+    {
+        CHECK(j.to_string() == "[1.5,-2.25,3.0,0.0]");
+        CHECK(j.as<std::string>() == "[1.5,-2.25,3.0,0.0]");
+    }
+
+    SECTION("mutation")
+    {
+        j.push_back(4.5);
+        CHECK(j.storage_kind() == json_storage_kind::array_value);
+        CHECK(j == json::parse("[1.5,-2.25,3.0,0.0,4.5]"));
+
+        json k = decode_packed<json>(data);
+        k[0] = 7;
+        CHECK(k.storage_kind() == json_storage_kind::array_value);
+        CHECK(k == json::parse("[7,-2.25,3.0,0.0]"));
+
+        json m = decode_packed<json>(data);
+        m.clear();
+        CHECK(m.is_array());
+        CHECK(m.empty());
+    }
+
+    SECTION("copy, move and swap")
+    {
+        json copy(j);
+        CHECK(copy.storage_kind() == json_storage_kind::typed_array_value);
+        CHECK(copy == j);
+
+        json moved(std::move(copy));
+        CHECK(moved.storage_kind() == json_storage_kind::typed_array_value);
+        CHECK(moved == j);
+
+        json other("abc");
+        swap(other, moved);
+        CHECK(other == j);
+        CHECK(moved.as<std::string>() == "abc");
+
+        json assigned;
+        assigned = other;
+        CHECK(assigned == j);
+    }
+}
+
+TEST_CASE("json typed array element types")
+{
+    SECTION("uint16")
+    {
+        std::vector<uint16_t> v = {0, 1, 65535};
+        json j = decode_packed<json>(encode_typed_array(v));
+        CHECK(j.storage_kind() == json_storage_kind::typed_array_value);
+        CHECK(j.as<std::vector<uint16_t>>() == v);
+        CHECK(j == json::parse("[0,1,65535]"));
+        CHECK(j[2].is_uint64());
+    }
+
+    SECTION("int64")
+    {
+        std::vector<int64_t> v = {-1, (std::numeric_limits<int64_t>::min)(), 17};
+        json j = decode_packed<json>(encode_typed_array(v));
+        CHECK(j.storage_kind() == json_storage_kind::typed_array_value);
+        CHECK(j.as<std::vector<int64_t>>() == v);
+        CHECK(j[1].is_int64());
+    }
+
+    SECTION("uint8 as bytes")
+    {
+        std::vector<uint8_t> v = {1, 2, 255};
+        json j(typed_array_arg, span<const uint8_t>(v));
+        CHECK(j.as<std::vector<uint8_t>>() == v);
+        CHECK(j.to_string() == "[1,2,255]");
+    }
+
+    SECTION("half")
+    {
+        std::vector<uint16_t> v = {0x3c00, 0xc000};
+        json j(typed_array_arg, half_arg, span<const uint16_t>(v));
+        CHECK(j.size() == 2);
+        CHECK(j.as<std::vector<double>>() == std::vector<double>{1.0, -2.0});
+
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data, cbor::cbor_options{}.use_typed_arrays(true));
+        json j2 = decode_packed<json>(data);
+        CHECK(j2.storage_kind() == json_storage_kind::typed_array_value);
+        CHECK(j2 == j);
+    }
+
+    SECTION("empty")
+    {
+        std::vector<double> v;
+        json j(typed_array_arg, span<const double>(v));
+        CHECK(j.is_array());
+        CHECK(j.empty());
+        CHECK(j == json(json_array_arg));
+        CHECK(j.to_string() == "[]");
+    }
+}
+
+TEST_CASE("json typed array in a document")
+{
+    std::vector<double> v = {0.5, 1.5};
+    std::vector<uint8_t> data;
+    auto options = cbor::cbor_options{}
+        .use_typed_arrays(true);
+    cbor::cbor_bytes_encoder encoder(data, options);
+    encoder.begin_object();
+    encoder.key("values");
+    encoder.typed_array(span<const double>(v));
+    encoder.key("name");
+    encoder.string_value("x");
+    encoder.end_object();
+    encoder.flush();
+
+    ojson j = decode_packed<ojson>(data);
+    CHECK(j.at("values").storage_kind() == json_storage_kind::typed_array_value);
+    CHECK(j.at("values").as<std::vector<double>>() == v);
+    CHECK(j.to_string() == R"({"values":[0.5,1.5],"name":"x"})");
+
+    std::vector<uint8_t> data2;
+    cbor::encode_cbor(j, data2, options);
+    ojson j2 = decode_packed<ojson>(data2);
+    CHECK(j2.at("values").storage_kind() == json_storage_kind::typed_array_value);
+    CHECK(j2 == j);
+}
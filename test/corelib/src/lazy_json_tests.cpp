@@ -0,0 +1,205 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons/lazy_json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick [\"}", "isbn": "0-553-21311-3", "price": 8.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95}
+    },
+    "a\"b" : {"é" : [true, false, null]},
+    "empty object" : {},
+    "empty array" : [ ],
+    "expensive": 10
+}
+    )";
+
+    // Compares a lazy view with the same value read into a basic_json, by navigation only
+    void check_same(const lazy_json& lazy, const ojson& expected)
+    {
+        if (expected.is_object())
+        {
+            REQUIRE(lazy.is_object());
+            CHECK(lazy.size() == expected.size());
+            auto it = expected.object_range().begin();
+            for (const auto& member : lazy.object_range())
+            {
+                REQUIRE((it != expected.object_range().end()));
+                CHECK(std::string(member.key()) == it->key());
+                check_same(member.value(), it->value());
+                ++it;
+            }
+            CHECK((it == expected.object_range().end()));
+            for (const auto& member : expected.object_range())
+            {
+                CHECK(lazy.contains(member.key()));
+                check_same(lazy.at(member.key()), member.value());
+            }
+        }
+        else if (expected.is_array())
+        {
+            REQUIRE(lazy.is_array());
+            CHECK(lazy.size() == expected.size());
+            std::size_t i = 0;
+            for (const auto& element : lazy.array_range())
+            {
+                REQUIRE(i < expected.size());
+                check_same(element, expected[i]);
+                ++i;
+            }
+            CHECK(i == expected.size());
+            for (i = 0; i < expected.size(); ++i)
+            {
+                check_same(lazy[i], expected[i]);
+            }
+        }
+        else
+        {
+            CHECK(lazy.is_string() == expected.is_string());
+            CHECK(lazy.is_bool() == expected.is_bool());
+            CHECK(lazy.is_null() == expected.is_null());
+            CHECK(lazy.is_number() == expected.is_number());
+            CHECK(lazy.as<ojson>() == expected);
+        }
+    }
+
+} // namespace
+
+TEST_CASE("lazy_json navigation")
+{
+    lazy_json doc(input);
+    json expected = json::parse(input);
+
+    SECTION("at and index")
+    {
+        CHECK(doc.at("store").at("book")[2].at("title").as<std::string>() == "Moby Dick [\"}");
+        CHECK(doc["store"]["bicycle"]["price"].as<double>() == 19.95);
+        CHECK(doc.at("expensive").as<int>() == 10);
+        CHECK(doc.at("a\"b").at("\xC3\xA9")[0].as<bool>());
+        CHECK(doc.at("a\"b").at("\xC3\xA9")[2].is_null());
+    }
+
+    SECTION("repeated lookups use the recorded offsets")
+    {
+        auto book = doc.at("store").at("book");
+        CHECK(book[1].at("price").as<double>() == 12.99);
+        CHECK(book[0].at("price").as<double>() == 8.95);
+        CHECK(doc.at("store").at("book")[1].at("author").as<std::string>() == "Evelyn Waugh");
+    }
+
+    SECTION("as json")
+    {
+        CHECK(doc.at("store").as<json>() == expected.at("store"));
+        CHECK(doc.as<json>() == expected);
+        CHECK(doc.at("store").at("book")[0].as<std::map<std::string,json>>().size() == 4);
+    }
+
+    SECTION("text")
+    {
+        CHECK(doc.at("store").at("bicycle").text() == R"({"color": "red", "price": 19.95})");
+        CHECK(doc.at("expensive").text() == "10");
+        CHECK(doc.at("empty array").text() == "[ ]");
+    }
+
+    SECTION("size and empty")
+    {
+        CHECK(doc.size() == 5);
+        CHECK(doc.at("store").at("book").size() == 3);
+        CHECK(doc.at("empty object").empty());
+        CHECK(doc.at("empty array").empty());
+        CHECK(doc.at("empty array").size() == 0);
+        CHECK_FALSE(doc.at("store").empty());
+        CHECK(doc.at("expensive").size() == 0);
+    }
+
+    SECTION("missing")
+    {
+        CHECK_FALSE(doc.contains("missing"));
+        CHECK_FALSE(doc.at("expensive").contains("missing"));
+        CHECK_THROWS_AS(doc.at("missing"), key_not_found);
+        CHECK_THROWS_AS(doc.at("expensive").at("missing"), not_an_object);
+        CHECK_THROWS_AS(doc.at("store").at("book")[3], std::out_of_range);
+        CHECK_THROWS(doc.at("store")[0]);
+    }
+
+    SECTION("whole document")
+    {
+        check_same(doc, ojson::parse(input));
+    }
+}
+
+TEST_CASE("lazy_json parses only what is navigated")
+{
+    std::string text = R"({"a" : [1, 2, {"b" : "]"}], "c" : 3, "d" : [tru, , {)";
+    lazy_json doc(text);
+
+    CHECK(doc.at("c").as<int>() == 3);
+    CHECK(doc.at("a")[2].at("b").as<std::string>() == "]");
+    CHECK_THROWS_AS(doc.at("d"), ser_error);
+}
+
+TEST_CASE("lazy_json errors")
+{
+    std::vector<std::pair<std::string,std::error_code>> inputs = {
+        {R"({"a" 1})", json_errc::expected_colon},
+        {R"({"a":1 "b":2})", json_errc::expected_comma_or_rbrace},
+        {R"({"a":1, 2})", json_errc::expected_key},
+        {R"([1 2])", json_errc::expected_comma_or_rbracket},
+        {R"([1,])", json_errc::expected_value},
+        {R"({"a":[1,2)", json_errc::unexpected_eof},
+        {R"({"a":"abc)", json_errc::unexpected_eof}
+    };
+    for (const auto& item : inputs)
+    {
+        INFO(item.first);
+        lazy_json doc(item.first);
+        std::error_code ec;
+        JSONCONS_TRY
+        {
+            doc.size();
+            doc.at("z");
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            ec = e.code();
+        }
+        CHECK(ec == item.second);
+    }
+
+    CHECK_THROWS_AS(lazy_json("  "), ser_error);
+}
+
+TEST_CASE("lazy_json scalar documents")
+{
+    CHECK(lazy_json(" 12.5 ").as<double>() == 12.5);
+    CHECK(lazy_json("\"x\"").as<std::string>() == "x");
+    CHECK(lazy_json("false").is_bool());
+    CHECK_THROWS_AS(lazy_json("tru").as<bool>(), ser_error);
+}
+
+TEST_CASE("wlazy_json")
+{
+    std::wstring text = LR"({"a" : {"b" : [10, 20, 30]}, "c" : "é"})";
+    wlazy_json doc(text);
+    CHECK(doc.at(L"a").at(L"b")[1].as<int>() == 20);
+    CHECK(doc.at(L"c").as<std::wstring>() == L"é");
+    CHECK(doc.at(L"a").at(L"b").size() == 3);
+}
@@ -0,0 +1,111 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <catch/catch.hpp>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+TEST_CASE("mmap_source tests")
+{
+    std::string path = "./corelib/output/mmap_source.txt";
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << "012345678";
+    }
+
+    SECTION("get and peek")
+    {
+        jsoncons::mmap_source<char> source(path);
+        CHECK_FALSE(source.is_error());
+
+        char b;
+        auto p0 = source.peek();
+        CHECK(p0.value == '0');
+        CHECK(source.read(&b,1) == 1);
+        CHECK(b == '0');
+        CHECK(source.position() == 1);
+        source.ignore(2);
+        CHECK(source.peek().value == '3');
+        CHECK(source.position() == 3);
+
+        auto s = source.read_buffer();
+        CHECK(std::string(s.data(), s.size()) == "345678");
+        CHECK(source.eof());
+        CHECK(source.peek().eof);
+        CHECK(source.read(&b,1) == 0);
+    }
+
+    SECTION("move")
+    {
+        jsoncons::mmap_source<char> source1(path);
+        source1.ignore(4);
+        jsoncons::mmap_source<char> source2(std::move(source1));
+        CHECK(source1.eof());
+        CHECK(source2.position() == 4);
+
+        jsoncons::mmap_source<char> source3;
+        source3 = std::move(source2);
+        auto s = source3.read_buffer();
+        CHECK(std::string(s.data(), s.size()) == "45678");
+    }
+
+    SECTION("binary")
+    {
+        jsoncons::mmap_binary_source source(path);
+        std::vector<uint8_t> v;
+        CHECK(jsoncons::source_reader<jsoncons::mmap_binary_source>::read(source, v, 9) == 9);
+        CHECK(source.eof());
+        CHECK(std::string(v.begin(), v.end()) == "012345678");
+    }
+
+    SECTION("missing file")
+    {
+        jsoncons::mmap_source<char> source("./corelib/input/no-such-file.json");
+        CHECK(source.is_error());
+        CHECK(source.eof());
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("mmap_source with reader and cursor")
+{
+    std::string path = "./corelib/input/address-book.json";
+    std::ifstream is(path);
+    jsoncons::json expected = jsoncons::json::parse(is);
+
+    SECTION("json_reader")
+    {
+        jsoncons::json_decoder<jsoncons::json> decoder;
+        jsoncons::basic_json_reader<char,jsoncons::mmap_source<char>> reader(path, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("json_cursor")
+    {
+        jsoncons::basic_json_cursor<char,jsoncons::mmap_source<char>> cursor{jsoncons::mmap_source<char>(path)};
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            if (cursor.current().event_type() == jsoncons::staj_event_type::key)
+            {
+                ++count;
+            }
+        }
+        CHECK(count > 0);
+    }
+
+    SECTION("missing file")
+    {
+        jsoncons::json_decoder<jsoncons::json> decoder;
+        jsoncons::basic_json_reader<char,jsoncons::mmap_source<char>> reader("./corelib/input/no-such-file.json", decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == jsoncons::json_errc::source_error);
+    }
+}
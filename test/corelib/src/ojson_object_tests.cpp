@@ -332,6 +332,144 @@ TEST_CASE("test_ojson_merge_or_update_move")
     }
 }
 
+namespace {
+
+    std::size_t erase_test_allocations = 0;
+
+    template <class T>
+    struct erase_counting_allocator
+    {
+        using value_type = T;
+
+        erase_counting_allocator() = default;
+
+        template <class U>
+        erase_counting_allocator(const erase_counting_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++erase_test_allocations;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const erase_counting_allocator&, const erase_counting_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const erase_counting_allocator&, const erase_counting_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("ojson large object erase does not allocate")
+{
+    using counted_ojson = basic_json<char,order_preserving_policy,erase_counting_allocator<char>>;
+
+    const std::size_t n = 100;
+    counted_ojson doc(json_object_arg);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        doc.try_emplace("key" + std::to_string(i), i);
+    }
+
+    std::size_t before = erase_test_allocations;
+    doc.erase("key10");
+    doc.erase(doc.find("key20"));
+    doc.erase(doc.object_range().begin(), doc.object_range().begin()+5);
+    while (doc.size() > 20)
+    {
+        doc.erase(doc.object_range().begin());
+    }
+    CHECK(erase_test_allocations == before);
+
+    CHECK(doc.size() == 20);
+    CHECK(doc.at("key80").as<std::size_t>() == 80);
+    CHECK(doc.at("key99").as<std::size_t>() == 99);
+    CHECK_FALSE(doc.contains("key79"));
+}
+
+TEST_CASE("ojson large object lookup")
+{
+    const std::size_t n = 100;
+    ojson doc;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        doc.try_emplace("key" + std::to_string(i), i);
+    }
+
+    SECTION("find")
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK(doc.at("key" + std::to_string(i)).as<std::size_t>() == i);
+        }
+        CHECK_FALSE(doc.contains("key100"));
+        CHECK(doc.object_range().begin()->key() == "key0");
+    }
+
+    SECTION("insert_or_assign and try_emplace")
+    {
+        CHECK_FALSE(doc.try_emplace("key50", 0).second);
+        doc.insert_or_assign("key50", -1);
+        doc.insert_or_assign("key100", 100);
+        CHECK(doc.size() == n + 1);
+        CHECK(doc.at("key50").as<int>() == -1);
+        CHECK(doc.at("key100").as<int>() == 100);
+        CHECK((doc.object_range().end()-1)->key() == "key100");
+    }
+
+    SECTION("erase")
+    {
+        doc.erase("key10");
+        doc.erase(doc.find("key20"));
+        doc.erase(doc.object_range().begin(), doc.object_range().begin()+5);
+        CHECK(doc.size() == n - 7);
+        CHECK_FALSE(doc.contains("key10"));
+        CHECK_FALSE(doc.contains("key20"));
+        CHECK_FALSE(doc.contains("key4"));
+        CHECK(doc.at("key99").as<std::size_t>() == 99);
+        CHECK(doc.at("key5").as<std::size_t>() == 5);
+
+        while (doc.size() > 3)
+        {
+            doc.erase(doc.object_range().begin());
+        }
+        CHECK(doc.at("key98").as<std::size_t>() == 98);
+        CHECK_FALSE(doc.contains("key96"));
+    }
+
+    SECTION("copy, parse and merge")
+    {
+        ojson copy(doc);
+        CHECK(copy == doc);
+        CHECK(copy.at("key77").as<std::size_t>() == 77);
+
+        std::string s;
+        doc.dump(s);
+        ojson parsed = ojson::parse(s);
+        CHECK(parsed == doc);
+        CHECK(parsed.at("key33").as<std::size_t>() == 33);
+
+        ojson other;
+        other.try_emplace("key1", -1);
+        other.try_emplace("extra", -2);
+        copy.merge(other);
+        CHECK(copy.at("key1").as<int>() == 1);
+        CHECK(copy.at("extra").as<int>() == -2);
+    }
+}
+
 #if defined(JSONCONS_HAS_STATEFUL_ALLOCATOR)
 
 #include <common/FreeListAllocator.hpp>
@@ -518,3 +656,74 @@ TEST_CASE("custom_json merge_or_update test")
 }
 
 #endif
+
+namespace {
+
+    bool fail_index_allocation = false;
+
+    // Fails to allocate the size_t elements of a hash index while fail_index_allocation is set
+    template <class T>
+    struct index_failing_allocator
+    {
+        using value_type = T;
+
+        index_failing_allocator() = default;
+
+        template <class U>
+        index_failing_allocator(const index_failing_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (fail_index_allocation && std::is_same<T,std::size_t>::value)
+            {
+                throw std::bad_alloc();
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const index_failing_allocator&, const index_failing_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const index_failing_allocator&, const index_failing_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("ojson insert when the index fails to allocate")
+{
+    using failing_ojson = basic_json<char,order_preserving_policy,index_failing_allocator<char>>;
+
+    failing_ojson doc(json_object_arg);
+    for (std::size_t i = 0; i < 15; ++i)
+    {
+        doc.try_emplace("key" + std::to_string(i), i);
+    }
+
+    fail_index_allocation = true;
+    CHECK_NOTHROW(doc.try_emplace("key15", 15));
+    CHECK_NOTHROW(doc.insert_or_assign("key16", 16));
+    fail_index_allocation = false;
+
+    CHECK(doc.size() == 17);
+    CHECK(doc.at("key15").as<std::size_t>() == 15);
+    CHECK(doc.at("key16").as<std::size_t>() == 16);
+
+    doc.try_emplace("key17", 17);
+    for (std::size_t i = 0; i < 18; ++i)
+    {
+        CHECK(doc.at("key" + std::to_string(i)).as<std::size_t>() == i);
+    }
+    CHECK_FALSE(doc.contains("key18"));
+}
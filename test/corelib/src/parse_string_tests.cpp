@@ -124,3 +124,57 @@ TEST_CASE("test_parse_big_string2")
 }
 
 
+
+TEST_CASE("test_parse_long_string_with_escape")
+{
+    // Exercise the block scan with the escape at every offset and every chunk size
+    std::string text(70, 'a');
+
+    for (std::size_t pos = 0; pos <= text.length(); ++pos)
+    {
+        std::string expected = text;
+        expected.insert(pos, "\"");
+        std::string input = "\"" + text.substr(0, pos) + "\\\"" + text.substr(pos) + "\"";
+
+        json j = json::parse(input);
+        CHECK(j.as<std::string>() == expected);
+
+        for (std::size_t i = 16; i < input.length(); i += 7)
+        {
+            std::istringstream is(input);
+            json_decoder<json> decoder;
+            json_stream_reader reader(stream_source<char>(is,i), decoder);
+            reader.read_next();
+            REQUIRE(decoder.is_valid());
+            CHECK(decoder.get_result().as<std::string>() == expected);
+        }
+    }
+}
+
+TEST_CASE("test_parse_long_string_with_multibyte_characters")
+{
+    std::string expected;
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        expected.append("\xce\xb1\xce\xb2 text \xe2\x82\xac");
+    }
+    json j = json::parse("\"" + expected + "\"");
+    CHECK(j.as<std::string>() == expected);
+}
+
+TEST_CASE("test_parse_long_string_with_control_character")
+{
+    std::string text(70, 'a');
+
+    for (std::size_t pos = 0; pos <= text.length(); ++pos)
+    {
+        std::string input = "\"" + text.substr(0, pos) + "\x01" + text.substr(pos) + "\"";
+
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_string_reader reader(input, decoder);
+        reader.read(ec);
+        CHECK(ec == json_errc::illegal_control_character);
+        CHECK(reader.column() == pos + 3);
+    }
+}
@@ -0,0 +1,414 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::size_t allocation_count = 0;
+
+    template <class T>
+    struct counting_allocator
+    {
+        using value_type = T;
+
+        counting_allocator() = default;
+
+        template <class U>
+        counting_allocator(const counting_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++allocation_count;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+    // A stateful allocator, equal only to allocators with the same id
+    template <class T, bool Propagate = false>
+    struct id_allocator
+    {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::integral_constant<bool,Propagate>;
+        using propagate_on_container_move_assignment = std::integral_constant<bool,Propagate>;
+
+        template <class U>
+        struct rebind
+        {
+            using other = id_allocator<U,Propagate>;
+        };
+
+        int id;
+
+        explicit id_allocator(int id) noexcept
+            : id(id)
+        {
+        }
+
+        template <class U>
+        id_allocator(const id_allocator<U,Propagate>& other) noexcept
+            : id(other.id)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const id_allocator& lhs, const id_allocator& rhs) noexcept
+        {
+            return lhs.id == rhs.id;
+        }
+
+        friend bool operator!=(const id_allocator& lhs, const id_allocator& rhs) noexcept
+        {
+            return lhs.id != rhs.id;
+        }
+    };
+
+    // Counts live instances, move assignment throws when armed, copy construction when copy_armed
+    struct throwing_item
+    {
+        static int live;
+        static bool armed;
+        static bool copy_armed;
+
+        int value;
+
+        throwing_item(int value) : value(value) {++live;}
+        throwing_item(const throwing_item& other) : value(other.value) 
+        {
+            if (copy_armed)
+            {
+                throw std::runtime_error("copy");
+            }
+            ++live;
+        }
+        throwing_item(throwing_item&& other) : value(other.value) {++live;}
+        ~throwing_item() {--live;}
+
+        throwing_item& operator=(const throwing_item& other) = default;
+        throwing_item& operator=(throwing_item&& other)
+        {
+            if (armed)
+            {
+                throw std::runtime_error("move assignment");
+            }
+            value = other.value;
+            return *this;
+        }
+    };
+
+    int throwing_item::live = 0;
+    bool throwing_item::armed = false;
+    bool throwing_item::copy_armed = false;
+
+    template <class Json>
+    std::size_t count_allocations(const std::string& s)
+    {
+        std::size_t before = allocation_count;
+        json_decoder<Json> decoder;
+        json_string_reader reader(s, decoder);
+        reader.read();
+        Json j = decoder.get_result();
+        return allocation_count - before;
+    }
+
+} // namespace
+
+TEST_CASE("small_vector tests")
+{
+    using vector_type = small_vector<std::string,std::allocator<std::string>,2>;
+
+    SECTION("grows out of the inline buffer")
+    {
+        vector_type v;
+        CHECK(v.is_inline());
+        CHECK(v.capacity() == 2);
+        v.push_back("one");
+        v.emplace_back("two");
+        CHECK(v.is_inline());
+        v.emplace_back("three");
+        CHECK_FALSE(v.is_inline());
+        CHECK(v.capacity() >= 3);
+        REQUIRE(v.size() == 3);
+        CHECK(v[0] == "one");
+        CHECK(v[1] == "two");
+        CHECK(v[2] == "three");
+        CHECK_THROWS_AS(v.at(3), std::out_of_range);
+
+        v.pop_back();
+        v.shrink_to_fit();
+        CHECK(v.is_inline());
+        REQUIRE(v.size() == 2);
+        CHECK(v.back() == "two");
+    }
+
+    SECTION("insert and erase")
+    {
+        vector_type v{"a", "d"};
+        auto it = v.insert(v.begin() + 1, "c");
+        CHECK(*it == "c");
+        v.emplace(v.begin() + 1, "b");
+        std::vector<std::string> tail = {"e", "f"};
+        v.insert(v.end(), tail.begin(), tail.end());
+        CHECK((v == vector_type{"a", "b", "c", "d", "e", "f"}));
+
+        v.emplace(v.begin(), v[5]);
+        CHECK(v.front() == "f");
+
+        it = v.erase(v.begin(), v.begin() + 2);
+        CHECK(*it == "b");
+        v.erase(v.begin() + 1);
+        CHECK((v == vector_type{"b", "d", "e", "f"}));
+
+        v.resize(1);
+        CHECK((v == vector_type{"b"}));
+        v.resize(3, "x");
+        CHECK((v == vector_type{"b", "x", "x"}));
+    }
+
+    SECTION("copy, move and swap")
+    {
+        vector_type small{"a"};
+        vector_type large{"a", "b", "c"};
+
+        vector_type copy(large);
+        CHECK(copy == large);
+
+        vector_type moved(std::move(copy));
+        CHECK(moved == large);
+        CHECK(copy.empty());
+
+        small.swap(moved);
+        CHECK(small == large);
+        CHECK((moved == vector_type{"a"}));
+        CHECK(moved < small);
+
+        moved = small;
+        CHECK(moved == small);
+        small = vector_type{"z"};
+        CHECK(small.size() == 1);
+        CHECK(moved < small);
+    }
+
+    SECTION("swap with unequal allocators")
+    {
+        using stateful_vector_type = small_vector<std::string,id_allocator<std::string>,2>;
+        CHECK(noexcept(std::declval<vector_type&>().swap(std::declval<vector_type&>())));
+        CHECK_FALSE(noexcept(std::declval<stateful_vector_type&>().swap(std::declval<stateful_vector_type&>())));
+
+        stateful_vector_type small({"a"}, id_allocator<std::string>(1));
+        stateful_vector_type large({"a", "b", "c"}, id_allocator<std::string>(2));
+        small.swap(large);
+        CHECK((small == stateful_vector_type({"a", "b", "c"}, id_allocator<std::string>(1))));
+        CHECK((large == stateful_vector_type({"a"}, id_allocator<std::string>(2))));
+        CHECK(small.get_allocator().id == 1);
+        CHECK(large.get_allocator().id == 2);
+    }
+
+    SECTION("assignment propagates the allocator if the traits say so")
+    {
+        using stateful_vector_type = small_vector<std::string,id_allocator<std::string>,2>;
+        using propagating_vector_type = small_vector<std::string,id_allocator<std::string,true>,2>;
+
+        stateful_vector_type a({"a", "b", "c"}, id_allocator<std::string>(1));
+        stateful_vector_type b({"x"}, id_allocator<std::string>(2));
+        b = a;
+        CHECK(b == a);
+        CHECK(b.get_allocator().id == 2);
+        b = std::move(a);
+        CHECK((b == stateful_vector_type({"a", "b", "c"}, id_allocator<std::string>(1))));
+        CHECK(b.get_allocator().id == 2);
+
+        propagating_vector_type c({"a", "b", "c"}, id_allocator<std::string,true>(1));
+        propagating_vector_type d({"x", "y", "z"}, id_allocator<std::string,true>(2));
+        d = c;
+        CHECK(d == c);
+        CHECK(d.get_allocator().id == 1);
+
+        propagating_vector_type e({"x", "y", "z"}, id_allocator<std::string,true>(3));
+        const std::string* data = c.data();
+        e = std::move(c);
+        CHECK(e.get_allocator().id == 1);
+        CHECK(e.data() == data); // took the buffer
+        CHECK((e == propagating_vector_type({"a", "b", "c"}, id_allocator<std::string,true>(1))));
+    }
+
+    SECTION("emplace in the middle when a move throws")
+    {
+        {
+            small_vector<throwing_item,std::allocator<throwing_item>,4> v;
+            v.emplace_back(1);
+            v.emplace_back(2);
+            v.emplace_back(3);
+
+            throwing_item::armed = true;
+            CHECK_THROWS_AS(v.emplace(v.begin(), 0), std::runtime_error);
+            throwing_item::armed = false;
+            CHECK(throwing_item::live == static_cast<int>(v.size()));
+        }
+        CHECK(throwing_item::live == 0);
+    }
+
+    SECTION("growing when a copy throws")
+    {
+        {
+            // The move constructor may throw, so relocation copies the elements
+            small_vector<throwing_item,std::allocator<throwing_item>,2> v;
+            v.emplace_back(1);
+            v.emplace_back(2);
+
+            throwing_item::copy_armed = true;
+            CHECK_THROWS_AS(v.emplace_back(3), std::runtime_error);
+            CHECK_THROWS_AS(v.reserve(10), std::runtime_error);
+            throwing_item::copy_armed = false;
+            CHECK(v.is_inline());
+            REQUIRE(v.size() == 2);
+            CHECK(v[0].value == 1);
+            CHECK(v[1].value == 2);
+            CHECK(throwing_item::live == 2);
+
+            v.emplace_back(3);
+            v.emplace_back(4);
+            REQUIRE(v.size() == v.capacity());
+            throwing_item::copy_armed = true;
+            CHECK_THROWS_AS(v.emplace(v.begin() + 1, 0), std::runtime_error);
+            throwing_item::copy_armed = false;
+            REQUIRE(v.size() == 4);
+            CHECK(v[1].value == 2);
+            CHECK(throwing_item::live == 4);
+
+            v.pop_back();
+            throwing_item::copy_armed = true;
+            CHECK_THROWS_AS(v.shrink_to_fit(), std::runtime_error);
+            throwing_item::copy_armed = false;
+            REQUIRE(v.size() == 3);
+            CHECK(v[0].value == 1);
+            CHECK(v[2].value == 3);
+            CHECK(throwing_item::live == 3);
+        }
+        CHECK(throwing_item::live == 0);
+    }
+
+    SECTION("no space for the buffer pointer of a plain pointer allocator")
+    {
+        struct layout
+        {
+            std::allocator<std::string> alloc;
+            std::string* data;
+            std::size_t size;
+            std::size_t capacity;
+            alignas(std::string) unsigned char buffer[2*sizeof(std::string)];
+        };
+        CHECK(sizeof(vector_type) == sizeof(layout));
+    }
+}
+
+TEST_CASE("small_json tests")
+{
+    std::string input = R"(
+{
+    "books" : [
+        {"title" : "Pulp", "author" : "Charles Bukowski", "price" : 22.48, "tags" : ["fiction"]},
+        {"title" : "Sula", "author" : "Toni Morrison", "price" : 13.01, "tags" : ["fiction", "classic"]},
+        {"title" : "The Trial", "author" : "Franz Kafka", "price" : 9.5, "tags" : []}
+    ],
+    "count" : 3
+}
+    )";
+
+    SECTION("same values as json")
+    {
+        small_json j = small_json::parse(input);
+        json expected = json::parse(input);
+
+        CHECK(j.size() == expected.size());
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j["books"][1]["tags"][1].as<std::string>() == "classic");
+        CHECK(j.at("count").as<int>() == 3);
+    }
+
+    SECTION("order preserving")
+    {
+        small_ojson j = small_ojson::parse(input);
+        CHECK(j.to_string() == ojson::parse(input).to_string());
+        CHECK(j.object_range().begin()->key() == "books");
+    }
+
+    SECTION("modify")
+    {
+        small_json j = small_json::parse(input);
+        small_json& books = j["books"];
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            books[0]["tags"].push_back(std::to_string(i));
+        }
+        books.insert(books.array_range().begin(), small_json::parse(R"({"title" : "Emma"})"));
+        books.erase(books.array_range().end() - 1);
+        j["count"] = 3;
+        j["store"] = "Main";
+
+        CHECK(books.size() == 3);
+        CHECK(books[0]["title"].as<std::string>() == "Emma");
+        CHECK(books[1]["tags"].size() == 11);
+        CHECK(books[1]["tags"][10].as<std::string>() == "9");
+        CHECK(j.size() == 3);
+
+        small_json copy = j;
+        CHECK(copy == j);
+        j["books"][0]["title"] = "Persuasion";
+        CHECK_FALSE(copy == j);
+    }
+}
+
+TEST_CASE("small_json allocations")
+{
+    using counted_json = basic_json<char,sorted_policy,counting_allocator<char>>;
+    using counted_small_json = basic_json<char,small_sorted_policy<>,counting_allocator<char>>;
+
+    std::string input = R"([[1,2],[3,4,5],{"a":1,"b":[true]},{"x":null},[],{},[6,7,8,9]])";
+
+    // Less the allocations of the decoder itself
+    std::size_t count = count_allocations<counted_json>(input) - count_allocations<counted_json>("null");
+    std::size_t small_count = count_allocations<counted_small_json>(input) - count_allocations<counted_small_json>("null");
+
+    // One for each container and one for each non-empty element buffer
+    CHECK(count == 16);
+    // One for each container and one for the elements of the outer array
+    CHECK(small_count == 10);
+}
@@ -9,6 +9,9 @@
 #include <utility>
 #include <ctime>
 #include <cwchar>
+#include <cstring>
+#include <algorithm>
+#include <string>
 #include <catch/catch.hpp>
 
 using namespace jsoncons;
@@ -50,6 +53,48 @@ TEST_CASE("test_exponent")
     json j1 = json::parse(s1);
     double expected1 = 1.15507e+173;
     CHECK( j1.as<double>() == expected1);
+}
+
+
+TEST_CASE("chars_to correctly rounded")
+{
+    jsoncons::detail::chars_to to_double;
+
+    std::vector<std::string> inputs = {
+        "0", "-0", "0.0", "1", "-1.5", "0.1", "0.30000000000000004", "123.456e-7",
+        "9007199254740993", "9007199254740992.5", "9007199254740993.0000000001",
+        "1.00000000000000011102230246251565404236316680908203125", // halfway, rounds to even
+        "1.00000000000000011102230246251565404236316680908203126",
+        "123456789012345678901234567890", "0.000000000000000000000000000001234567890123456789012",
+        "1e23", "8.98846567431158e307", "1.7976931348623157e308", "1.7976931348623159e308", "2e308",
+        "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324",
+        "2.4703282292062327e-324", "2.4703282292062328e-324", "1e-400", "1e400",
+        "1.15507e-173", "1.15507e+173", "7.2057594037927933e16"
+    };
+    for (const auto& s : inputs)
+    {
+        std::string input(s);
+        char decimal_point = to_double.get_decimal_point();
+        std::replace(input.begin(), input.end(), '.', decimal_point);
 
+        double expected = strtod(input.c_str(), nullptr);
+        double actual = to_double(input.c_str(), input.length());
+        INFO(s);
+        CHECK(std::memcmp(&actual, &expected, sizeof(double)) == 0);
+    }
 }
 
+TEST_CASE("chars_to other forms")
+{
+    jsoncons::detail::chars_to to_double;
+
+    // Forms outside the JSON number grammar are left to strtod
+    CHECK(to_double("+2", 2) == 2.0);
+    CHECK(to_double("  3", 3) == 3.0);
+    CHECK(to_double("0x10", 4) == 16.0);
+    CHECK_THROWS(to_double("abc", 3));
+
+    // A buffer padded with null characters
+    char buffer[16] = {'1','2','5','e','-','2'};
+    CHECK(to_double(buffer, sizeof(buffer)) == 1.25);
+}
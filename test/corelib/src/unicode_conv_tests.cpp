@@ -57,3 +57,103 @@ BOOST_AUTO_TEST_CASE( test1 )
 }
 #endif
 
+
+namespace {
+
+    // Validates one character at a time
+    unicode_traits::convert_result<char> validate_scalar(const char* data, std::size_t length)
+    {
+        const char* last = data + length;
+        while (data != last)
+        {
+            std::size_t len = static_cast<std::size_t>(unicode_traits::trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
+            if (len > (std::size_t)(last - data))
+            {
+                return unicode_traits::convert_result<char>{data, unicode_traits::conv_errc::source_exhausted};
+            }
+            unicode_traits::conv_errc result = unicode_traits::is_legal_utf8(data, len);
+            if (result != unicode_traits::conv_errc())
+            {
+                return unicode_traits::convert_result<char>{data, result};
+            }
+            data += len;
+        }
+        return unicode_traits::convert_result<char>{data, unicode_traits::conv_errc()};
+    }
+
+} // namespace
+
+TEST_CASE("unicode_traits::validate utf8")
+{
+    const std::vector<std::string> pieces = {
+        "a", "0123456789abcdef", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf", 
+        "\xed\x9f\xbf", "\xee\x80\x80", "\xc2\x80", "\xdf\xbf", "\xef\xbf\xbf", "\xf0\x90\x80\x80"
+    };
+    const std::vector<std::string> bad = {
+        "\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xe0\x80\x80", "\xe0\x9f\xbf", "\xed\xa0\x80", "\xed\xbf\xbf",
+        "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\xfe",
+        "\xc3", "\xe2\x82", "\xf0\x9f\x98", "\xc3\xc3", "\xe2\x28\xa1", "\xf0\x9f\x28\x80"
+    };
+
+    SECTION("valid")
+    {
+        std::string s;
+        for (std::size_t i = 0; i < 500; ++i)
+        {
+            s.append(pieces[(i * 7) % pieces.size()]);
+            auto expected = validate_scalar(s.data(), s.size());
+            auto result = unicode_traits::validate(s.data(), s.size());
+            REQUIRE(expected.ec == unicode_traits::conv_errc());
+            CHECK(result.ec == expected.ec);
+            CHECK(result.ptr == s.data() + s.size());
+        }
+    }
+
+    SECTION("invalid at every position")
+    {
+        std::string prefix;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            prefix.append(pieces[(i * 5) % pieces.size()]);
+            for (const auto& b : bad)
+            {
+                for (const std::string& suffix : {std::string(), std::string(40, 'x'), pieces[i % pieces.size()] + std::string(70, 'y')})
+                {
+                    std::string s = prefix + b + suffix;
+                    auto expected = validate_scalar(s.data(), s.size());
+                    auto result = unicode_traits::validate(s.data(), s.size());
+                    REQUIRE(expected.ec != unicode_traits::conv_errc());
+                    CHECK(result.ec == expected.ec);
+                    CHECK(result.ptr == expected.ptr);
+                }
+            }
+        }
+    }
+
+    SECTION("random bytes")
+    {
+        uint32_t state = 12345;
+        for (std::size_t n = 0; n < 2000; ++n)
+        {
+            std::string s;
+            std::size_t length = n % 200;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                uint32_t r = state >> 16;
+                if (r % 4 == 0)
+                {
+                    s.push_back(static_cast<char>(r >> 8));
+                }
+                else
+                {
+                    s.append(pieces[(r >> 4) % pieces.size()]);
+                }
+            }
+            auto expected = validate_scalar(s.data(), s.size());
+            auto result = unicode_traits::validate(s.data(), s.size());
+            CHECK(result.ec == expected.ec);
+            CHECK(result.ptr == expected.ptr);
+        }
+    }
+}
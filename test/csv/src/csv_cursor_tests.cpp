@@ -8,8 +8,11 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons_ext/csv/csv_cursor.hpp>
 #include <jsoncons_ext/csv/csv.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <catch/catch.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -977,3 +980,44 @@ TEMPLATE_TEST_CASE("csv_cursor reset test", "",
         check_csv_cursor_table("with input3", cursor, "h3", 3);
     }
 }
+
+TEST_CASE("csv reader and cursor with mmap_source")
+{
+    std::string data = "name,value\nfirst,1\nsecond,2.5\n";
+    std::string path = "./corelib/output/mmap_source.csv";
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << data;
+    }
+    auto options = csv::csv_options{}.assume_header(true);
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        csv::basic_csv_reader<char,jsoncons::mmap_source<char>> reader(path, decoder, options);
+        reader.read();
+        CHECK(decoder.get_result() == csv::decode_csv<json>(data, options));
+    }
+
+    SECTION("cursor")
+    {
+        csv::basic_csv_cursor<char,jsoncons::mmap_source<char>> cursor(jsoncons::mmap_source<char>(path), options);
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count == 14);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        csv::basic_csv_reader<char,jsoncons::mmap_source<char>> reader("./corelib/output/no-such-file.csv", decoder, options);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == csv::csv_errc::source_error);
+    }
+
+    std::remove(path.c_str());
+}
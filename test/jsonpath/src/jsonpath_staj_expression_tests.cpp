@@ -0,0 +1,256 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string store = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95, "parts" : [{"name" : "wheel", "price" : 5}]}
+    },
+    "expensive": 10
+}
+    )";
+
+    using result_list = std::vector<std::pair<std::string,json>>;
+
+    result_list query_dom(const json& root, const std::string& path)
+    {
+        result_list results;
+        jsonpath::json_query(root, path,
+            [&results](const std::string& p, const json& value) {results.emplace_back(p, value);},
+            jsonpath::result_options::nodups);
+        std::sort(results.begin(), results.end());
+        return results;
+    }
+
+    template <class Cursor, class Input>
+    result_list query_stream(const Input& input, const std::string& path)
+    {
+        result_list results;
+        auto expr = jsonpath::make_staj_expression<json>(path);
+        Cursor cursor(input);
+        expr.evaluate(cursor, [&results](const std::string& p, const json& value) {results.emplace_back(p, value);});
+        CHECK(cursor.done());
+        std::sort(results.begin(), results.end());
+        return results;
+    }
+
+    class outermost_counter : public default_json_visitor
+    {
+        std::size_t depth_ = 0;
+    public:
+        std::size_t count = 0;
+    private:
+        bool visit_begin_object(semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (depth_++ == 0) ++count;
+            return true;
+        }
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            --depth_;
+            return true;
+        }
+        bool visit_begin_array(semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (depth_++ == 0) ++count;
+            return true;
+        }
+        bool visit_end_array(const ser_context&, std::error_code&) override
+        {
+            --depth_;
+            return true;
+        }
+        bool visit_string(const string_view_type&, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (depth_ == 0) ++count;
+            return true;
+        }
+        bool visit_double(double, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (depth_ == 0) ++count;
+            return true;
+        }
+        bool visit_uint64(uint64_t, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (depth_ == 0) ++count;
+            return true;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("jsonpath staj_expression matches json_query")
+{
+    json root = json::parse(store);
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(root, data);
+
+    std::vector<std::string> paths = {
+        "$",
+        "$.store",
+        "$.store.book[*].author",
+        "$..author",
+        "$.store.*",
+        "$..book[2]",
+        "$..book[0:2]",
+        "$..book[::2]",
+        "$..book[1:]",
+        "$..*",
+        "$['store']['bicycle'][\"color\"]",
+        "$..book[?(@.isbn)]",
+        "$..book[?(@.price < 10)].title",
+        "$..[?(@.price > 10)]",
+        "$.store[?(@.color == 'red')]",
+        "$..book[?(@.author =~ /.*Tolkien$/)].title",
+        "$.store..price",
+        "$[*]",
+        "$..[0]",
+        "$..*..price",
+        "$.missing",
+        "$.store.book[10]",
+        "$ . store . book [ 1 ] . title"
+    };
+
+    for (const auto& path : paths)
+    {
+        INFO(path);
+        auto expected = query_dom(root, path);
+        CHECK(query_stream<json_string_cursor>(store, path) == expected);
+        CHECK(query_stream<cbor::cbor_bytes_cursor>(data, path) == expected);
+    }
+}
+
+TEST_CASE("jsonpath staj_expression document order")
+{
+    auto expr = jsonpath::make_staj_expression<json>("$..price");
+    json_string_cursor cursor(store);
+    std::vector<std::string> paths;
+    expr.evaluate(cursor, [&paths](const std::string& p, const json&) {paths.push_back(p);});
+
+    std::vector<std::string> expected = {
+        "$['store']['book'][0]['price']",
+        "$['store']['book'][1]['price']",
+        "$['store']['book'][2]['price']",
+        "$['store']['book'][3]['price']",
+        "$['store']['bicycle']['price']",
+        "$['store']['bicycle']['parts'][0]['price']"
+    };
+    CHECK(paths == expected);
+}
+
+TEST_CASE("jsonpath staj_expression to visitor")
+{
+    SECTION("single match")
+    {
+        auto expr = jsonpath::make_staj_expression<json>("$.store.bicycle");
+        json_string_cursor cursor(store);
+        json_decoder<json> decoder;
+        expr.evaluate(cursor, decoder);
+        CHECK(decoder.get_result() == json::parse(store).at("store").at("bicycle"));
+    }
+
+    SECTION("outermost matches")
+    {
+        outermost_counter counter;
+        auto expr = jsonpath::make_staj_expression<json>("$..*");
+        json_string_cursor cursor(store);
+        expr.evaluate(cursor, counter);
+        CHECK(counter.count == 2);
+    }
+
+    SECTION("filtered matches")
+    {
+        outermost_counter counter;
+        auto expr = jsonpath::make_staj_expression<json>("$.store.book[?(@.category == 'fiction')]");
+        json_string_cursor cursor(store);
+        expr.evaluate(cursor, counter);
+        CHECK(counter.count == 3);
+    }
+}
+
+TEST_CASE("jsonpath staj_expression large stream")
+{
+    std::string input = "{\"records\":[";
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i > 0)
+        {
+            input.push_back(',');
+        }
+        input.append("{\"header\":{\"skip\":[1,2,{\"id\":-1}]},\"payload\":{\"id\":" + std::to_string(i) + ",\"text\":\"]}\"}}");
+    }
+    input.append("]}");
+
+    std::istringstream is(input);
+    json_stream_cursor cursor(is);
+    auto expr = jsonpath::make_staj_expression<json>("$.records[*].payload.id");
+    std::vector<int> ids;
+    expr.evaluate(cursor, [&ids](const std::string&, const json& value) {ids.push_back(value.as<int>());});
+    REQUIRE(ids.size() == 1000);
+    CHECK(ids.front() == 0);
+    CHECK(ids.back() == 999);
+}
+
+TEST_CASE("jsonpath staj_expression errors")
+{
+    std::vector<std::pair<std::string,std::error_code>> paths = {
+        {"store", jsonpath::jsonpath_errc::expected_root_or_current_node},
+        {"$.store.book[-1]", jsonpath::jsonpath_errc::not_streamable},
+        {"$.store.book[-2:]", jsonpath::jsonpath_errc::not_streamable},
+        {"$.store.book[0,1]", jsonpath::jsonpath_errc::not_streamable},
+        {"$..book[?(@.price < $.expensive)]", jsonpath::jsonpath_errc::not_streamable},
+        {"$.store.book[::0]", jsonpath::jsonpath_errc::step_cannot_be_zero},
+        {"$.store.book[0", jsonpath::jsonpath_errc::expected_rbracket},
+        {"$.store.", jsonpath::jsonpath_errc::unexpected_eof},
+        {"$['store", jsonpath::jsonpath_errc::unexpected_eof}
+    };
+    for (const auto& item : paths)
+    {
+        INFO(item.first);
+        std::error_code ec;
+        jsonpath::make_staj_expression<json>(item.first, ec);
+        CHECK(ec == item.second);
+    }
+
+    CHECK_THROWS_AS(jsonpath::make_staj_expression<json>("$.store.book[-1]"), jsonpath::jsonpath_error);
+
+    std::error_code ec;
+    auto expr = jsonpath::make_staj_expression<json>("$.a");
+    json_string_cursor cursor(R"({"b":[1,2,)");
+    expr.evaluate(cursor, [](const std::string&, const json&) {}, ec);
+    CHECK(ec == json_errc::unexpected_eof);
+}
+
+TEST_CASE("jsonpath staj_expression wide characters")
+{
+    std::wstring input = LR"({"a":{"été":[1,2,3]},"b":2})";
+    auto expr = jsonpath::make_staj_expression<wjson>(L"$.a['\\u00e9t\\u00e9'][1]");
+    wjson_string_cursor cursor(input);
+    std::vector<std::wstring> paths;
+    expr.evaluate(cursor, [&paths](const std::wstring& p, const wjson& value) {paths.push_back(p); CHECK(value.as<int>() == 2);});
+    REQUIRE(paths.size() == 1);
+}
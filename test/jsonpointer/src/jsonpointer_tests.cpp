@@ -5,8 +5,10 @@
 #include "windows.h" // test no inadvertant macro expansions
 #endif
 #include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <catch/catch.hpp>
+#include <common/seek_test_utilities.hpp>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -741,3 +743,20 @@ TEST_CASE("jsonpointer get with stateful allocator")
 }
 
 #endif
+
+TEST_CASE("json_cursor seek")
+{
+    json j = seek_test_document();
+
+    SECTION("compact")
+    {
+        check_seek<json_string_cursor>(j.to_string());
+    }
+
+    SECTION("pretty printed")
+    {
+        std::string data;
+        j.dump_pretty(data);
+        check_seek<json_string_cursor>(data);
+    }
+}
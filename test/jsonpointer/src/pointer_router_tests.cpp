@@ -0,0 +1,240 @@
+// Copyright 2013-2023 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/jsonpointer/pointer_router.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95}
+    },
+    "0": {"1": "key", "~/": [null, true, -1]},
+    "expensive": 10
+}
+    )";
+
+    class event_counter : public default_json_visitor
+    {
+    public:
+        std::size_t count = 0;
+    private:
+        bool visit_begin_object(semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_end_object(const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_begin_array(semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_end_array(const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_key(const string_view_type&, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_string(const string_view_type&, semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_double(double, semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_uint64(uint64_t, semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_int64(int64_t, semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_bool(bool, semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+        bool visit_null(semantic_tag, const ser_context&, std::error_code&) override {++count; return true;}
+    };
+
+} // namespace
+
+TEST_CASE("pointer_router matches jsonpointer::get")
+{
+    json root = json::parse(input);
+
+    std::vector<std::string> locations = {
+        "",
+        "/store",
+        "/store/book",
+        "/store/book/0",
+        "/store/book/1/author",
+        "/store/book/2/isbn",
+        "/store/book/2/isbn", // same location twice
+        "/store/bicycle/color",
+        "/0",
+        "/0/1",
+        "/0/~0~1",
+        "/0/~0~1/2",
+        "/expensive",
+        "/missing",
+        "/store/book/3",
+        "/store/book/-",
+        "/store/bicycle/color/0"
+    };
+
+    std::multimap<std::string,json> results;
+    jsonpointer::pointer_router router;
+    for (const auto& location : locations)
+    {
+        router.subscribe<json>(location, [&results,location](json&& value) {results.emplace(location, std::move(value));});
+    }
+    CHECK(router.subscription_count() == locations.size());
+
+    SECTION("json")
+    {
+        json_string_reader reader(input, router);
+        reader.read();
+    }
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(root, data);
+        cbor::cbor_bytes_reader reader(data, router);
+        reader.read();
+    }
+
+    for (const auto& location : locations)
+    {
+        INFO(location);
+        std::error_code ec;
+        const json& expected = jsonpointer::get(root, location, ec);
+        auto range = results.equal_range(location);
+        if (ec)
+        {
+            CHECK(results.count(location) == 0);
+        }
+        else
+        {
+            REQUIRE(std::distance(range.first, range.second) == (location == "/store/book/2/isbn" ? 2 : 1));
+            CHECK(range.first->second == expected);
+        }
+    }
+}
+
+TEST_CASE("pointer_router document order")
+{
+    std::vector<std::string> order;
+    jsonpointer::pointer_router router;
+    for (const auto* location : {"/expensive", "/store/book/1/title", "/store/book/1", "/store", "/store/book/0/price"})
+    {
+        std::string s(location);
+        router.subscribe<json>(s, [&order,s](const json&) {order.push_back(s);});
+    }
+
+    json_string_reader reader(input, router);
+    reader.read();
+
+    // A match is reported when its value ends, so inner values come first
+    std::vector<std::string> expected = {"/store/book/0/price", "/store/book/1/title", "/store/book/1", "/store", "/expensive"};
+    CHECK(order == expected);
+}
+
+TEST_CASE("pointer_router to visitors")
+{
+    std::string buffer;
+    compact_json_string_encoder encoder(buffer);
+    event_counter counter;
+
+    jsonpointer::pointer_router router;
+    router.subscribe("/store/bicycle", encoder);
+    router.subscribe(jsonpointer::json_pointer("/store/book/1/author"), counter);
+    router.subscribe("/0/~0~1", counter);
+
+    json_string_reader reader(input, router);
+    reader.read();
+
+    CHECK(buffer == R"({"color":"red","price":19.95})");
+    CHECK(counter.count == 6); // 1 string + begin_array, null, true, -1, end_array
+}
+
+TEST_CASE("pointer_router reuse over documents")
+{
+    jsonpointer::pointer_router router;
+    std::vector<int> values;
+    router.subscribe<json>("/a/1", [&values](const json& value) {values.push_back(value.as<int>());});
+
+    for (const auto* text : {R"({"a":[1,2,3]})", R"({"b":{"a":[4,5]},"a":[6,7]})", "[1,2]", R"({"a":{"1":8}})"})
+    {
+        json_string_reader reader(text, router);
+        reader.read();
+    }
+    CHECK(values == std::vector<int>{2, 7, 8});
+
+    std::error_code ec;
+    json_string_reader reader(R"({"a":[1,)", router);
+    reader.read(ec);
+    CHECK(ec);
+    router.reset();
+
+    json_string_reader reader2(R"({"a":[9,10]})", router);
+    reader2.read();
+    CHECK(values == std::vector<int>{2, 7, 8, 10});
+}
+
+TEST_CASE("pointer_router many subscriptions")
+{
+    json root(json_object_arg);
+    for (int i = 0; i < 50; ++i)
+    {
+        json record(json_object_arg);
+        record.try_emplace("id", i);
+        record.try_emplace("tags", json(json_array_arg, {"x", "y"}));
+        root.try_emplace("field" + std::to_string(i), std::move(record));
+    }
+    std::string text = root.to_string();
+
+    std::vector<int> ids(50, -1);
+    jsonpointer::pointer_router router;
+    for (int i = 0; i < 50; i += 2)
+    {
+        router.subscribe<json>("/field" + std::to_string(i) + "/id", [&ids,i](const json& value) {ids[i] = value.as<int>();});
+    }
+
+    json_string_reader reader(text, router);
+    reader.read();
+    for (int i = 0; i < 50; ++i)
+    {
+        CHECK(ids[i] == (i % 2 == 0 ? i : -1));
+    }
+}
+
+TEST_CASE("pointer_router invalid pointer")
+{
+    jsonpointer::pointer_router router;
+    CHECK_THROWS_AS(router.subscribe<json>("a/b", [](const json&) {}), jsonpointer::jsonpointer_error);
+}
+
+TEST_CASE("pointer_router array index with leading zeros")
+{
+    std::string text = R"({"a":[10,20],"b":{"01":"key"}})";
+
+    std::map<std::string,json> results;
+    jsonpointer::pointer_router router;
+    for (std::string location : {"/a/1", "/a/01", "/a/00", "/b/01"})
+    {
+        router.subscribe<json>(location, [&results,location](json&& value) {results.emplace(location, std::move(value));});
+    }
+    json_string_reader reader(text, router);
+    reader.read();
+
+    CHECK(results.size() == 2);
+    CHECK(results["/a/1"] == json(20));
+    CHECK(results["/b/01"] == json("key"));
+}
+
+TEST_CASE("wpointer_router")
+{
+    std::wstring text = LR"({"a":{"b":[10,20]}})";
+    std::vector<int> values;
+    jsonpointer::wpointer_router router;
+    router.subscribe<wjson>(L"/a/b/1", [&values](const wjson& value) {values.push_back(value.as<int>());});
+
+    wjson_string_reader reader(text, router);
+    reader.read();
+    CHECK(values == std::vector<int>{20});
+}
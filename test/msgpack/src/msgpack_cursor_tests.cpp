@@ -8,8 +8,12 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons_ext/msgpack/msgpack_cursor.hpp>
 #include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <catch/catch.hpp>
+#include <common/seek_test_utilities.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -386,3 +390,217 @@ TEMPLATE_TEST_CASE("msgpack_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    struct event_record
+    {
+        staj_event_type type;
+        std::string value;
+        std::size_t column;
+
+        friend bool operator==(const event_record& lhs, const event_record& rhs)
+        {
+            return lhs.type == rhs.type && lhs.value == rhs.value && lhs.column == rhs.column;
+        }
+    };
+
+    event_record record_event(const staj_cursor& cursor)
+    {
+        const staj_event& event = cursor.current();
+        std::string value;
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+                value = event.get<std::string>();
+                break;
+            default:
+                break;
+        }
+        return event_record{event.event_type(), value, cursor.context().column()};
+    }
+
+    void check_skip_at_every_container(const std::vector<uint8_t>& data)
+    {
+        std::vector<event_record> events;
+        {
+            msgpack::msgpack_bytes_cursor cursor(data);
+            for (; !cursor.done(); cursor.next())
+            {
+                events.push_back(record_event(cursor));
+            }
+        }
+
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            if (!(events[i].type == staj_event_type::begin_array || events[i].type == staj_event_type::begin_object))
+            {
+                continue;
+            }
+            std::size_t j = i;
+            std::size_t depth = 0;
+            do
+            {
+                if (events[j].type == staj_event_type::begin_array || events[j].type == staj_event_type::begin_object)
+                {
+                    ++depth;
+                }
+                else if (events[j].type == staj_event_type::end_array || events[j].type == staj_event_type::end_object)
+                {
+                    --depth;
+                }
+                ++j;
+            }
+            while (depth > 0);
+
+            msgpack::msgpack_bytes_cursor cursor(data);
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                cursor.next();
+            }
+            cursor.skip();
+            if (j == events.size())
+            {
+                CHECK(cursor.done());
+            }
+            else
+            {
+                REQUIRE_FALSE(cursor.done());
+                CHECK(record_event(cursor) == events[j]);
+            }
+        }
+    }
+
+} // namespace
+
+TEST_CASE("msgpack_cursor skip")
+{
+    json j = json::parse(R"(
+{
+    "a" : [1, -2, 300, -70000, 5000000000, 1.5, "short", "a string longer than thirty one characters", true, null],
+    "b" : {"c" : [[], {}, [[1]]], "d" : {"e" : "f"}},
+    "g" : [{"h" : [1,2,3]}, 4]
+}
+    )");
+    j["bytes"] = json(byte_string_arg, std::vector<uint8_t>{1,2,3,4,5});
+
+    std::vector<uint8_t> data;
+    msgpack::encode_msgpack(j, data);
+
+    SECTION("every container")
+    {
+        check_skip_at_every_container(data);
+    }
+
+    SECTION("large containers")
+    {
+        json a(json_array_arg);
+        for (int i = 0; i < 70000; ++i)
+        {
+            a.push_back(i % 3 == 0 ? json(i) : json(std::string(static_cast<std::size_t>(i % 300), 'x')));
+        }
+        json k(json_object_arg);
+        k["a"] = a;
+        k["b"] = json(json_object_arg, {{"c",1}});
+        k["d"] = 2;
+        std::vector<uint8_t> data2;
+        msgpack::encode_msgpack(k, data2);
+
+        msgpack::msgpack_bytes_cursor cursor(data2);
+        cursor.next();
+        cursor.next();
+        cursor.skip();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == "b");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "d");
+    }
+
+    SECTION("end events")
+    {
+        std::vector<uint8_t> data2;
+        msgpack::encode_msgpack(json::parse(R"([[1,2],{"a":3},4])"), data2);
+
+        msgpack::msgpack_bytes_cursor cursor(data2);
+        for (int i = 0; i < 4; ++i)
+        {
+            cursor.next();
+        }
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.skip();
+        REQUIRE_FALSE(cursor.done());
+        CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.skip();
+        REQUIRE_FALSE(cursor.done());
+        CHECK(cursor.current().get<int>() == 4);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.skip();
+        CHECK(cursor.done());
+    }
+
+    SECTION("unexpected eof")
+    {
+        std::vector<uint8_t> truncated(data.begin(), data.end() - 10);
+        msgpack::msgpack_bytes_cursor cursor(truncated);
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == msgpack::msgpack_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("msgpack_cursor seek")
+{
+    std::vector<uint8_t> data;
+    msgpack::encode_msgpack(seek_test_document(), data);
+    check_seek<msgpack::msgpack_bytes_cursor>(data);
+}
+
+TEST_CASE("msgpack reader and cursor with mmap_binary_source")
+{
+    json j = json::parse(R"({"title":"Canada","values":[1,2.5,"three",null,true]})");
+    std::string path = "./corelib/output/mmap_source.msgpack";
+    {
+        std::ofstream os(path, std::ios::binary);
+        msgpack::encode_msgpack(j, os);
+    }
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        msgpack::basic_msgpack_reader<jsoncons::mmap_binary_source> reader(path, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("cursor")
+    {
+        msgpack::basic_msgpack_cursor<jsoncons::mmap_binary_source> cursor(path);
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count == 12);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        msgpack::basic_msgpack_reader<jsoncons::mmap_binary_source> reader("./corelib/output/no-such-file.msgpack", decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == msgpack::msgpack_errc::source_error);
+    }
+
+    std::remove(path.c_str());
+}
@@ -8,8 +8,12 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons_ext/ubjson/ubjson_cursor.hpp>
 #include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <catch/catch.hpp>
+#include <common/seek_test_utilities.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -413,3 +417,77 @@ TEMPLATE_TEST_CASE("ubjson_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("ubjson_cursor skip")
+{
+    std::vector<uint8_t> data;
+    ubjson::encode_ubjson(json::parse(R"([[1,2],{"a":3},4])"), data);
+
+    ubjson::ubjson_bytes_cursor cursor(data);
+    for (int i = 0; i < 4; ++i)
+    {
+        cursor.next();
+    }
+    REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+    cursor.skip();
+    REQUIRE_FALSE(cursor.done());
+    CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+    cursor.next();
+    cursor.next();
+    cursor.next();
+    REQUIRE(cursor.current().event_type() == staj_event_type::end_object);
+    cursor.skip();
+    REQUIRE_FALSE(cursor.done());
+    CHECK(cursor.current().get<int>() == 4);
+    cursor.next();
+    REQUIRE(cursor.current().event_type() == staj_event_type::end_array);
+    cursor.skip();
+    CHECK(cursor.done());
+}
+
+TEST_CASE("ubjson_cursor seek")
+{
+    std::vector<uint8_t> data;
+    ubjson::encode_ubjson(seek_test_document(), data);
+    check_seek<ubjson::ubjson_bytes_cursor>(data);
+}
+
+TEST_CASE("ubjson reader and cursor with mmap_binary_source")
+{
+    json j = json::parse(R"({"title":"Canada","values":[1,2.5,"three",null,true]})");
+    std::string path = "./corelib/output/mmap_source.ubjson";
+    {
+        std::ofstream os(path, std::ios::binary);
+        ubjson::encode_ubjson(j, os);
+    }
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        ubjson::basic_ubjson_reader<jsoncons::mmap_binary_source> reader(path, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("cursor")
+    {
+        ubjson::basic_ubjson_cursor<jsoncons::mmap_binary_source> cursor(path);
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count == 12);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        ubjson::basic_ubjson_reader<jsoncons::mmap_binary_source> reader("./corelib/output/no-such-file.ubjson", decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == ubjson::ubjson_errc::source_error);
+    }
+
+    std::remove(path.c_str());
+}